@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Epoch stepping loops: inline compensated `Time<S>` arithmetic against one
+// tempoch-ffi call per step.
+
+#include <benchmark/benchmark.h>
+#include <tempoch/tempoch.hpp>
+
+using namespace tempoch;
+
+namespace {
+
+constexpr double kStepSeconds = 0.125;
+
+void BM_FfiStep(benchmark::State &state) {
+  const qtty_quantity_t step{kStepSeconds,
+                             qtty::UnitTraits<qtty::Second::unit_tag>::unit_id()};
+  for (auto _ : state) {
+    tempoch_time_t t = Time<scale::TT>().c_inner();
+    for (int64_t i = 0; i < state.range(0); ++i)
+      tempoch_time_add_seconds(t, step, &t);
+    benchmark::DoNotOptimize(t);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_InlineStep(benchmark::State &state) {
+  const qtty::Second step(kStepSeconds);
+  for (auto _ : state) {
+    Time<scale::TT> t;
+    for (int64_t i = 0; i < state.range(0); ++i)
+      t += step;
+    benchmark::DoNotOptimize(t);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_InlineStepDays(benchmark::State &state) {
+  const qtty::Day step(kStepSeconds);
+  for (auto _ : state) {
+    Time<scale::TT> t;
+    for (int64_t i = 0; i < state.range(0); ++i)
+      t += step;
+    benchmark::DoNotOptimize(t);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_InlineDifference(benchmark::State &state) {
+  const auto a = Time<scale::TT>::from_raw_j2000_seconds(qtty::Second(8.0e8));
+  auto b = a;
+  double acc = 0.0;
+  for (auto _ : state) {
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      b += qtty::Second(kStepSeconds);
+      acc += (b - a).value();
+    }
+    benchmark::DoNotOptimize(acc);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_FfiStep)->Arg(1 << 20)->Arg(100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_InlineStep)->Arg(1 << 20)->Arg(100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_InlineStepDays)->Arg(1 << 20)->Arg(100'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_InlineDifference)->Arg(1 << 20)->Arg(100'000'000)->Unit(benchmark::kMillisecond);
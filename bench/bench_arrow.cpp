@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Arrow C Data Interface: column export / import against per-element loops.
+
+#include <benchmark/benchmark.h>
+#include <tempoch/tempoch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+constexpr std::size_t kRows = 1 << 16;
+
+std::vector<Time<scale::UTC>> utc_rows() {
+  refresh_leap_table(); // lookups never build the snapshot
+  std::vector<Time<scale::UTC>> out;
+  for (std::size_t i = 0; i < kRows; ++i)
+    out.push_back(Time<scale::UTC>::from_split_seconds(
+        qtty::Second(8.0e8 + static_cast<double>(i)), qtty::Second(1.0e-9 * (i % 1'000))));
+  return out;
+}
+
+std::vector<ModifiedJulianDate<scale::TT>> mjd_rows() {
+  std::vector<ModifiedJulianDate<scale::TT>> out;
+  for (std::size_t i = 0; i < kRows; ++i)
+    out.emplace_back(61'236.0 + static_cast<double>(i) / 86'400.0);
+  return out;
+}
+
+void BM_ArrowExportTimestamps(benchmark::State &state) {
+  const auto rows = utc_rows();
+  for (auto _ : state) {
+    ArrowSchema schema;
+    ArrowArray array;
+    export_arrow_timestamps(span<const Time<scale::UTC>>(rows), &schema, &array);
+    benchmark::DoNotOptimize(array.buffers[1]);
+    array.release(&array);
+    schema.release(&schema);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+
+// Baseline: one `EncodedTime<UTC, Unix>` per value, scaled to integer nanoseconds.
+void BM_UnixNanosPerElement(benchmark::State &state) {
+  const auto rows = utc_rows();
+  std::vector<int64_t> nanos(kRows);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kRows; ++i)
+      nanos[i] = std::llround(rows[i].to<format::Unix>().value() * 1.0e9);
+    benchmark::DoNotOptimize(nanos.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+
+void BM_ArrowImportTimestamps(benchmark::State &state) {
+  const auto rows = utc_rows();
+  ArrowSchema schema;
+  ArrowArray array;
+  export_arrow_timestamps(span<const Time<scale::UTC>>(rows), &schema, &array);
+  const auto *nanos = static_cast<const int64_t *>(array.buffers[1]);
+  const void *buffers[2] = {nullptr, nanos};
+  for (auto _ : state) {
+    // A producer that never frees: each import consumes a fresh borrowed copy of the structs.
+    ArrowSchema s = schema;
+    ArrowArray a = array;
+    s.release = [](ArrowSchema *p) { p->release = nullptr; };
+    a.release = [](ArrowArray *p) { p->release = nullptr; };
+    a.buffers = buffers;
+    auto column = import_arrow_timestamps<scale::UTC>(&s, &a);
+    benchmark::DoNotOptimize(column.times.data());
+  }
+  array.release(&array);
+  schema.release(&schema);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+
+void BM_ArrowEncodedRoundTrip(benchmark::State &state) {
+  const auto rows = mjd_rows();
+  for (auto _ : state) {
+    ArrowSchema schema;
+    ArrowArray array;
+    export_arrow_view(span<const ModifiedJulianDate<scale::TT>>(rows), &schema, &array);
+    const auto column = import_arrow<scale::TT, format::MJD>(&schema, &array);
+    benchmark::DoNotOptimize(column.values().data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+
+} // namespace
+
+BENCHMARK(BM_ArrowExportTimestamps);
+BENCHMARK(BM_UnixNanosPerElement);
+BENCHMARK(BM_ArrowImportTimestamps);
+BENCHMARK(BM_ArrowEncodedRoundTrip);
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Batch scale conversion, columnar transcoding and civil batches against the
+// equivalent scalar loops.
+
+#include <benchmark/benchmark.h>
+#include <tempoch/tempoch.hpp>
+
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+std::vector<Time<scale::UTC>> utc_block(std::size_t n) {
+  refresh_leap_table(); // lookups never build the snapshot
+  auto start = Time<scale::UTC>::from_civil({2026, 1, 1, 0, 0, 0});
+  std::vector<Time<scale::UTC>> out;
+  out.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+    out.push_back(start + qtty::Second(static_cast<double>(i) * 37.25));
+  return out;
+}
+
+void BM_ScalarUtcToTt(benchmark::State &state) {
+  const auto utc = utc_block(static_cast<std::size_t>(state.range(0)));
+  std::vector<Time<scale::TT>> tt(utc.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < utc.size(); ++i)
+      tt[i] = utc[i].to<scale::TT>();
+    benchmark::DoNotOptimize(tt.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_BatchUtcToTt(benchmark::State &state) {
+  const auto utc = utc_block(static_cast<std::size_t>(state.range(0)));
+  std::vector<Time<scale::TT>> tt(utc.size());
+  for (auto _ : state) {
+    auto status = convert<scale::UTC, scale::TT>(utc, tt);
+    benchmark::DoNotOptimize(status);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+std::vector<double> unix_column(std::size_t n) {
+  refresh_leap_table(); // lookups never build the snapshot
+  std::vector<double> out(n);
+  for (std::size_t i = 0; i < n; ++i)
+    out[i] = 1.767e9 + static_cast<double>(i) * 0.125;
+  return out;
+}
+
+void BM_ScalarUnixDecode(benchmark::State &state) {
+  const auto raw = unix_column(static_cast<std::size_t>(state.range(0)));
+  std::vector<Time<scale::UTC>> out(raw.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < raw.size(); ++i)
+      out[i] = Time<scale::UTC>::from_encoded(UnixTime(raw[i]));
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ColumnUnixDecode(benchmark::State &state) {
+  const auto raw = unix_column(static_cast<std::size_t>(state.range(0)));
+  std::vector<Time<scale::UTC>> out(raw.size());
+  for (auto _ : state) {
+    auto status = decode_column<scale::UTC, format::Unix>(raw, out);
+    benchmark::DoNotOptimize(status);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+std::vector<CivilTime> sorted_civil(std::size_t n) {
+  std::vector<CivilTime> out;
+  out.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto sod = static_cast<uint32_t>((i * 7) % 86'399);
+    out.emplace_back(2026, 5, static_cast<uint8_t>(1 + (i * 7) / 86'399 % 28),
+                     static_cast<uint8_t>(sod / 3'600), static_cast<uint8_t>(sod / 60 % 60),
+                     static_cast<uint8_t>(sod % 60), 125'000'000u);
+  }
+  return out;
+}
+
+void BM_ScalarFromCivil(benchmark::State &state) {
+  const auto civil = sorted_civil(static_cast<std::size_t>(state.range(0)));
+  std::vector<Time<scale::UTC>> out(civil.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < civil.size(); ++i)
+      out[i] = Time<scale::UTC>::from_civil(civil[i]);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_BatchFromCivil(benchmark::State &state) {
+  const auto civil = sorted_civil(static_cast<std::size_t>(state.range(0)));
+  std::vector<Time<scale::UTC>> out(civil.size());
+  for (auto _ : state) {
+    auto status = from_civil(civil, out);
+    benchmark::DoNotOptimize(status);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_ScalarUtcToTt)->RangeMultiplier(16)->Range(1, 1 << 16);
+BENCHMARK(BM_BatchUtcToTt)->RangeMultiplier(16)->Range(1, 1 << 16);
+BENCHMARK(BM_ScalarUnixDecode)->RangeMultiplier(16)->Range(1, 1 << 16);
+BENCHMARK(BM_ColumnUnixDecode)->RangeMultiplier(16)->Range(1, 1 << 16);
+BENCHMARK(BM_ScalarFromCivil)->RangeMultiplier(16)->Range(1, 1 << 16);
+BENCHMARK(BM_BatchFromCivil)->RangeMultiplier(16)->Range(1, 1 << 16);
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Latency of `Time<UTC>::now()` / `Time<TAI>::now()` against the raw clock read
+// and the `system_clock` → Unix seconds → decode route.
+
+#include <benchmark/benchmark.h>
+#include <tempoch/tempoch.hpp>
+
+#include <chrono>
+
+using namespace tempoch;
+
+namespace {
+
+void BM_UnixClockRead(benchmark::State &state) {
+  for (auto _ : state)
+    benchmark::DoNotOptimize(detail::read_unix_clock());
+}
+
+void BM_UtcNow(benchmark::State &state) {
+  refresh_leap_table(); // lookups never build the snapshot
+  for (auto _ : state)
+    benchmark::DoNotOptimize(Time<scale::UTC>::now());
+}
+
+void BM_TaiNow(benchmark::State &state) {
+  refresh_leap_table(); // lookups never build the snapshot
+  for (auto _ : state)
+    benchmark::DoNotOptimize(Time<scale::TAI>::now());
+}
+
+// Baseline: the stamp built by hand from `system_clock` through a Unix `EncodedTime`.
+void BM_SystemClockDecode(benchmark::State &state) {
+  refresh_leap_table(); // lookups never build the snapshot
+  for (auto _ : state) {
+    const double unix_seconds =
+        std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    benchmark::DoNotOptimize(
+        Time<scale::UTC>::from_encoded(EncodedTime<scale::UTC, format::Unix>(unix_seconds)));
+  }
+}
+
+} // namespace
+
+BENCHMARK(BM_UnixClockRead);
+BENCHMARK(BM_UtcNow);
+BENCHMARK(BM_TaiNow);
+BENCHMARK(BM_SystemClockDecode);
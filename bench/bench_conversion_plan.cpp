@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Unix(UTC) → JD(TT) through a prebuilt ConversionPlan against the chained
+// decode / to / encode calls it replaces.
+
+#include <benchmark/benchmark.h>
+#include <tempoch/tempoch.hpp>
+
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+std::vector<double> unix_spread(std::size_t n) {
+  refresh_leap_table(); // lookups never build the snapshot
+  std::vector<double> out;
+  out.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+    out.push_back(1'500'000'000.0 + static_cast<double>(i % 4'096) * 77'777.25);
+  return out;
+}
+
+void BM_ChainedUnixToTtJd(benchmark::State &state) {
+  const auto unix_s = unix_spread(static_cast<std::size_t>(state.range(0)));
+  std::vector<double> jd(unix_s.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < unix_s.size(); ++i)
+      jd[i] = Time<scale::UTC>::from_encoded(UnixTime(unix_s[i]))
+                  .to<scale::TT, format::JD>()
+                  .value();
+    benchmark::DoNotOptimize(jd.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_PlanUnixToTtJd(benchmark::State &state) {
+  const auto unix_s = unix_spread(static_cast<std::size_t>(state.range(0)));
+  std::vector<double> jd(unix_s.size());
+  const ConversionPlan<scale::UTC, format::Unix, scale::TT, format::JD> plan;
+  for (auto _ : state) {
+    auto status = plan(unix_s, jd);
+    benchmark::DoNotOptimize(status);
+    benchmark::DoNotOptimize(jd.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_PlanTaiToTt(benchmark::State &state) {
+  std::vector<Time<scale::TAI>> tai;
+  for (double s : unix_spread(static_cast<std::size_t>(state.range(0))))
+    tai.push_back(
+        Time<scale::TAI>::from_split_seconds(qtty::Second(s - 946'728'000.0), qtty::Second(0.0)));
+  std::vector<Time<scale::TT>> tt(tai.size());
+  const ConversionPlan<scale::TAI, void, scale::TT, void> plan;
+  for (auto _ : state) {
+    auto status = plan(tai, tt);
+    benchmark::DoNotOptimize(status);
+    benchmark::DoNotOptimize(tt.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_ChainedUnixToTtJd)->Arg(4'096);
+BENCHMARK(BM_PlanUnixToTtJd)->Arg(4'096);
+BENCHMARK(BM_PlanTaiToTt)->Arg(4'096);
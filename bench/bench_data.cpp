@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Lookups into the bundled time data: EOP interpolation and ΔT.
+
+#include <benchmark/benchmark.h>
+#include <tempoch/tempoch.hpp>
+
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+constexpr std::size_t kSamples = 4'096;
+
+std::vector<double> mjd_inside_eop() {
+  std::vector<double> out;
+  out.reserve(kSamples);
+  for (std::size_t i = 0; i < kSamples; ++i)
+    out.push_back(55'000.125 + static_cast<double>(i) * 1.3);
+  return out;
+}
+
+void BM_EopAt(benchmark::State &state) {
+  const auto mjd = mjd_inside_eop();
+  for (auto _ : state) {
+    for (double m : mjd)
+      benchmark::DoNotOptimize(eop_at(m));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kSamples));
+}
+
+void BM_EopCovers(benchmark::State &state) {
+  const auto mjd = mjd_inside_eop();
+  for (auto _ : state) {
+    for (double m : mjd)
+      benchmark::DoNotOptimize(eop_covers(m));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kSamples));
+}
+
+void BM_DeltaTSeconds(benchmark::State &state) {
+  const auto mjd = mjd_inside_eop();
+  for (auto _ : state) {
+    for (double m : mjd)
+      benchmark::DoNotOptimize(delta_t_seconds(m + 2'400'000.5));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kSamples));
+}
+
+void BM_DeltaTSecondsExtrapolated(benchmark::State &state) {
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSamples; ++i)
+      benchmark::DoNotOptimize(
+          delta_t_seconds_extrapolated(2'470'000.5 + static_cast<double>(i) * 3.7));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kSamples));
+}
+
+} // namespace
+
+BENCHMARK(BM_EopAt);
+BENCHMARK(BM_EopCovers);
+BENCHMARK(BM_DeltaTSeconds);
+BENCHMARK(BM_DeltaTSecondsExtrapolated);
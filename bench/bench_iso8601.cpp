@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Timestamp ingestion: `parse_iso8601` against `std::get_time`.
+
+#include <benchmark/benchmark.h>
+#include <tempoch/tempoch.hpp>
+
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+constexpr std::size_t kLines = 4'096;
+constexpr std::size_t kStride = 31; // "YYYY-MM-DDThh:mm:ss.nnnnnnnnnZ\n"
+
+/// One second apart, with varying nanoseconds: a typical sorted log.
+const std::string &fixed_block() {
+  static const std::string block = [] {
+    std::string out;
+    char line[kStride + 1];
+    for (std::size_t i = 0; i < kLines; ++i) {
+      std::snprintf(line, sizeof line, "2026-07-15T%02zu:%02zu:%02zu.%09zuZ\n", i / 3'600 % 24,
+                    i / 60 % 60, i % 60, i * 7'919 % 1'000'000'000);
+      out += line;
+    }
+    return out;
+  }();
+  return block;
+}
+
+std::vector<std::string_view> lines() {
+  std::vector<std::string_view> out;
+  for (std::size_t i = 0; i < kLines; ++i)
+    out.emplace_back(fixed_block().data() + i * kStride, kStride - 1);
+  return out;
+}
+
+void BM_ParseIso8601(benchmark::State &state) {
+  const auto text = lines();
+  for (auto _ : state)
+    for (std::string_view line : text)
+      benchmark::DoNotOptimize(parse_iso8601(line));
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kLines));
+}
+
+void BM_ParseIso8601Fixed(benchmark::State &state) {
+  std::vector<CivilTime> out(kLines);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(parse_iso8601_fixed(fixed_block(), kStride, out).failed());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kLines));
+}
+
+/// `std::get_time` reads only the whole-second head, so it does less work than the others.
+void BM_StdGetTime(benchmark::State &state) {
+  const auto text = lines();
+  std::istringstream in;
+  for (auto _ : state) {
+    for (std::string_view line : text) {
+      std::tm tm{};
+      in.clear();
+      in.str(std::string(line));
+      in >> std::get_time(&tm, "%Y-%m-%dT%H:%M:%S");
+      benchmark::DoNotOptimize(tm);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kLines));
+}
+
+} // namespace
+
+BENCHMARK(BM_ParseIso8601);
+BENCHMARK(BM_ParseIso8601Fixed);
+BENCHMARK(BM_StdGetTime);
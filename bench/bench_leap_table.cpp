@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// UTC ↔ TAI through the in-process leap-second snapshot against a direct
+// tempoch-ffi call per instant.
+
+#include <benchmark/benchmark.h>
+#include <tempoch/tempoch.hpp>
+
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+std::vector<Time<scale::UTC>> utc_spread(std::size_t n) {
+  refresh_leap_table(); // lookups never build the snapshot
+  // Roughly one instant every 9 days from 1990 on, so lookups cross intervals.
+  auto start = Time<scale::UTC>::from_civil({1990, 1, 1, 6, 0, 0});
+  std::vector<Time<scale::UTC>> out;
+  out.reserve(n);
+  for (std::size_t i = 0; i < n; ++i)
+    out.push_back(start + qtty::Second(static_cast<double>(i % 4'096) * 777'777.5));
+  return out;
+}
+
+void BM_FfiUtcToTai(benchmark::State &state) {
+  const auto utc = utc_spread(static_cast<std::size_t>(state.range(0)));
+  std::vector<tempoch_time_t> tai(utc.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < utc.size(); ++i)
+      tempoch_time_scale_convert(utc[i].c_inner(), TEMPOCH_SCALE_TAG_T_UTC,
+                                 TEMPOCH_SCALE_TAG_T_TAI, nullptr, &tai[i]);
+    benchmark::DoNotOptimize(tai.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_LeapTableUtcToTai(benchmark::State &state) {
+  const auto utc = utc_spread(static_cast<std::size_t>(state.range(0)));
+  std::vector<Time<scale::TAI>> tai(utc.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < utc.size(); ++i)
+      tai[i] = utc[i].to<scale::TAI>();
+    benchmark::DoNotOptimize(tai.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_LeapTableUnixEncode(benchmark::State &state) {
+  const auto utc = utc_spread(static_cast<std::size_t>(state.range(0)));
+  std::vector<double> unix(utc.size());
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < utc.size(); ++i)
+      unix[i] = utc[i].to<format::Unix>().value();
+    benchmark::DoNotOptimize(unix.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_FfiUtcToTai)->RangeMultiplier(16)->Range(1, 1 << 16);
+BENCHMARK(BM_LeapTableUtcToTai)->RangeMultiplier(16)->Range(1, 1 << 16);
+BENCHMARK(BM_LeapTableUnixEncode)->RangeMultiplier(16)->Range(1, 1 << 16);
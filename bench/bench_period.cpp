@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Period construction, pairwise operations and the list operations from one
+// period up to 10^7.
+
+#include <benchmark/benchmark.h>
+#include <tempoch/tempoch.hpp>
+
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+using MjdPeriod = Period<ModifiedJulianDate<scale::TT>>;
+
+/// Sorted, disjoint half-day periods, one per day starting at @p offset_days.
+std::vector<MjdPeriod> period_list(std::size_t n, double offset_days = 0.0) {
+  std::vector<MjdPeriod> out;
+  out.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double start = 51'544.0 + offset_days + static_cast<double>(i);
+    out.emplace_back(ModifiedJulianDate<scale::TT>(start),
+                     ModifiedJulianDate<scale::TT>(start + 0.5));
+  }
+  return out;
+}
+
+/// The same list, shuffled deterministically and with every period overlapping its neighbour.
+std::vector<MjdPeriod> unsorted_overlapping(std::size_t n) {
+  std::vector<MjdPeriod> out;
+  out.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const double start = 51'544.0 + static_cast<double>((i * 7'919) % n) * 0.75;
+    out.emplace_back(ModifiedJulianDate<scale::TT>(start),
+                     ModifiedJulianDate<scale::TT>(start + 1.0));
+  }
+  return out;
+}
+
+void set_items(benchmark::State &state) {
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_PeriodNew(benchmark::State &state) {
+  const ModifiedJulianDate<scale::TT> a(60'000.0);
+  const ModifiedJulianDate<scale::TT> b(60'001.5);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(MjdPeriod(a, b));
+}
+
+void BM_PeriodIntersection(benchmark::State &state) {
+  const auto a = period_list(1)[0];
+  const auto b = period_list(1, 0.25)[0];
+  for (auto _ : state)
+    benchmark::DoNotOptimize(a.intersection(b));
+}
+
+void BM_PeriodDuration(benchmark::State &state) {
+  const auto a = period_list(1)[0];
+  for (auto _ : state)
+    benchmark::DoNotOptimize(a.duration<qtty::Day>());
+}
+
+void BM_TimePeriodEndpoints(benchmark::State &state) {
+  const auto t0 = Time<scale::TT>::from_split_seconds(qtty::Second(8.0e8));
+  const Period<Time<scale::TT>> period(t0, t0 + qtty::Second(3'600.0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(period.start());
+    benchmark::DoNotOptimize(period.end());
+  }
+}
+
+void BM_PeriodContains(benchmark::State &state) {
+  const auto a = period_list(1)[0];
+  const ModifiedJulianDate<scale::TT> point(51'544.25);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(a.contains(point));
+}
+
+void BM_FfiPeriodContains(benchmark::State &state) {
+  const auto a = period_list(1)[0];
+  for (auto _ : state)
+    benchmark::DoNotOptimize(tempoch_period_mjd_contains(a.c_inner(), 51'544.25));
+}
+
+void BM_ValidatePeriods(benchmark::State &state) {
+  const auto list = period_list(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state)
+    validate_periods(list);
+  set_items(state);
+}
+
+void BM_IntersectPeriods(benchmark::State &state) {
+  const auto a = period_list(static_cast<std::size_t>(state.range(0)));
+  const auto b = period_list(static_cast<std::size_t>(state.range(0)), 0.25);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(intersect_periods(a, b));
+  set_items(state);
+}
+
+void BM_UnionPeriods(benchmark::State &state) {
+  const auto a = period_list(static_cast<std::size_t>(state.range(0)));
+  const auto b = period_list(static_cast<std::size_t>(state.range(0)), 0.25);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(union_periods(a, b));
+  set_items(state);
+}
+
+/// Span input and a reused caller buffer: no C++ allocation per iteration.
+void BM_UnionPeriodsIntoBuffer(benchmark::State &state) {
+  const auto a = period_list(static_cast<std::size_t>(state.range(0)));
+  const auto b = period_list(static_cast<std::size_t>(state.range(0)), 0.25);
+  std::vector<MjdPeriod> out(a.size() + b.size(), a.front());
+  for (auto _ : state)
+    benchmark::DoNotOptimize(
+        union_periods(span<const MjdPeriod>(a), span<const MjdPeriod>(b), out.begin()));
+  set_items(state);
+}
+
+void BM_SweepUnion(benchmark::State &state) {
+  const auto a = period_list(static_cast<std::size_t>(state.range(0)));
+  const auto b = period_list(static_cast<std::size_t>(state.range(0)), 0.25);
+  for (auto _ : state) {
+    std::size_t count = 0;
+    for (const auto &period : sweep_union(a.begin(), a.end(), b.begin(), b.end())) {
+      benchmark::DoNotOptimize(period);
+      ++count;
+    }
+    benchmark::DoNotOptimize(count);
+  }
+  set_items(state);
+}
+
+void BM_NormalizePeriods(benchmark::State &state) {
+  const auto list = unsorted_overlapping(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(normalize_periods(list));
+  set_items(state);
+}
+
+/// Args: list size, worker threads.
+void BM_NormalizePeriodsParallel(benchmark::State &state) {
+  const auto list = unsorted_overlapping(static_cast<std::size_t>(state.range(0)));
+  const auto policy = par.with_threads(static_cast<unsigned>(state.range(1)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(normalize_periods(policy, list));
+  set_items(state);
+}
+
+void BM_ComplementOf(benchmark::State &state) {
+  const auto list = period_list(static_cast<std::size_t>(state.range(0)));
+  const MjdPeriod window(ModifiedJulianDate<scale::TT>(51'543.0),
+                         ModifiedJulianDate<scale::TT>(51'545.0 + list.size()));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(window.complement_of(list));
+  set_items(state);
+}
+
+void BM_PeriodSetContains(benchmark::State &state) {
+  const PeriodSet<ModifiedJulianDate<scale::TT>> set(
+      period_list(static_cast<std::size_t>(state.range(0))));
+  const double span_days = static_cast<double>(state.range(0));
+  double probe = 0.0;
+  for (auto _ : state) {
+    probe = probe + 0.618'033'988'75 < 1.0 ? probe + 0.618'033'988'75 : probe - 0.381'966'011'25;
+    const ModifiedJulianDate<scale::TT> point(51'544.0 + probe * span_days);
+    benchmark::DoNotOptimize(set.contains(point));
+  }
+}
+
+void BM_PeriodSetUnion(benchmark::State &state) {
+  using Set = PeriodSet<ModifiedJulianDate<scale::TT>>;
+  const Set a(period_list(static_cast<std::size_t>(state.range(0))));
+  const Set b(period_list(static_cast<std::size_t>(state.range(0)), 0.25));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(a | b);
+  set_items(state);
+}
+
+void BM_PeriodIndexBuild(benchmark::State &state) {
+  const auto list = unsorted_overlapping(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(PeriodIndex<ModifiedJulianDate<scale::TT>>(list));
+  set_items(state);
+}
+
+void BM_PeriodIndexContaining(benchmark::State &state) {
+  const PeriodIndex<ModifiedJulianDate<scale::TT>> index(
+      unsorted_overlapping(static_cast<std::size_t>(state.range(0))));
+  const double span_days = static_cast<double>(state.range(0)) * 0.75;
+  double probe = 0.0;
+  for (auto _ : state) {
+    probe = probe + 0.618'033'988'75 < 1.0 ? probe + 0.618'033'988'75 : probe - 0.381'966'011'25;
+    const ModifiedJulianDate<scale::TT> point(51'544.0 + probe * span_days);
+    std::size_t hits = 0;
+    index.for_each_containing(point, [&](std::size_t) { ++hits; });
+    benchmark::DoNotOptimize(hits);
+  }
+}
+
+void list_sizes(benchmark::internal::Benchmark *b) {
+  b->RangeMultiplier(10)->Range(1, 10'000'000)->Unit(benchmark::kMicrosecond);
+}
+
+} // namespace
+
+BENCHMARK(BM_PeriodNew);
+BENCHMARK(BM_PeriodIntersection);
+BENCHMARK(BM_PeriodDuration);
+BENCHMARK(BM_TimePeriodEndpoints);
+BENCHMARK(BM_PeriodContains);
+BENCHMARK(BM_FfiPeriodContains);
+BENCHMARK(BM_ValidatePeriods)->Apply(list_sizes);
+BENCHMARK(BM_IntersectPeriods)->Apply(list_sizes);
+BENCHMARK(BM_UnionPeriods)->Apply(list_sizes);
+BENCHMARK(BM_UnionPeriodsIntoBuffer)->Apply(list_sizes);
+BENCHMARK(BM_SweepUnion)->Apply(list_sizes);
+BENCHMARK(BM_NormalizePeriods)->Apply(list_sizes);
+BENCHMARK(BM_NormalizePeriodsParallel)
+    ->ArgsProduct({{100'000, 1'000'000, 10'000'000}, {1, 2, 4, 8, 16, 32}})
+    ->UseRealTime();
+BENCHMARK(BM_ComplementOf)->Apply(list_sizes);
+BENCHMARK(BM_PeriodSetContains)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(BM_PeriodSetUnion)->Apply(list_sizes);
+BENCHMARK(BM_PeriodIndexBuild)->Apply(list_sizes);
+BENCHMARK(BM_PeriodIndexContaining)->Arg(1'000)->Arg(1'000'000);
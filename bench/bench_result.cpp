@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Failure path cost: exception-based UT1 conversion against `checked_to_with`.
+
+#include <benchmark/benchmark.h>
+#include <tempoch/tempoch.hpp>
+
+using namespace tempoch;
+
+namespace {
+
+const Time<scale::TT> &beyond_ut1_horizon() {
+  static const auto t = Time<scale::TT>::from_encoded(JulianDate<scale::TT>(2'500'000.0));
+  return t;
+}
+
+void BM_ThrowingFailure(benchmark::State &state) {
+  const auto ctx = TimeContext::with_builtin_eop();
+  for (auto _ : state) {
+    try {
+      benchmark::DoNotOptimize(beyond_ut1_horizon().to_with<scale::UT1>(ctx));
+    } catch (const TempochException &e) {
+      benchmark::DoNotOptimize(e.what());
+    }
+  }
+}
+
+void BM_CheckedFailure(benchmark::State &state) {
+  const auto ctx = TimeContext::with_builtin_eop();
+  for (auto _ : state) {
+    auto result = beyond_ut1_horizon().checked_to_with<scale::UT1>(ctx);
+    benchmark::DoNotOptimize(result.status());
+  }
+}
+
+void BM_TryToFailure(benchmark::State &state) {
+  for (auto _ : state)
+    benchmark::DoNotOptimize(beyond_ut1_horizon().try_to<scale::UT1>());
+}
+
+} // namespace
+
+BENCHMARK(BM_ThrowingFailure);
+BENCHMARK(BM_CheckedFailure);
+BENCHMARK(BM_TryToFailure);
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Per-call cost of the scalar Time API: construction, every scale pair
+// through TT and UTC, format encode/decode, civil conversion and GNSS weeks.
+
+#include <benchmark/benchmark.h>
+#include <tempoch/tempoch.hpp>
+
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+constexpr std::size_t kSamples = 4'096;
+
+std::vector<double> mjd_samples() {
+  // 2000..2024, away from any leap second.
+  std::vector<double> out;
+  out.reserve(kSamples);
+  for (std::size_t i = 0; i < kSamples; ++i)
+    out.push_back(51'544.25 + static_cast<double>(i) * 2.1875);
+  return out;
+}
+
+template <typename S> std::vector<Time<S>> time_samples() {
+  std::vector<Time<S>> out;
+  out.reserve(kSamples);
+  for (double mjd : mjd_samples())
+    out.push_back(Time<S>::from_encoded(ModifiedJulianDate<S>(mjd)));
+  return out;
+}
+
+template <typename T> void sink(const std::vector<T> &out) {
+  benchmark::DoNotOptimize(out.data());
+  benchmark::ClobberMemory();
+}
+
+void set_items(benchmark::State &state) {
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kSamples));
+}
+
+// -- Construction ------------------------------------------------------------
+
+void BM_FromSplitSeconds(benchmark::State &state) {
+  std::vector<double> seconds;
+  for (double mjd : mjd_samples())
+    seconds.push_back((mjd - 51'544.5) * 86'400.0);
+  std::vector<Time<scale::TT>> out(kSamples);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSamples; ++i)
+      out[i] = Time<scale::TT>::from_split_seconds(qtty::Second(seconds[i]), qtty::Second(0.25));
+    sink(out);
+  }
+  set_items(state);
+}
+
+void BM_FromCivil(benchmark::State &state) {
+  std::vector<CivilTime> civil;
+  for (std::size_t i = 0; i < kSamples; ++i)
+    civil.emplace_back(2000 + static_cast<int32_t>(i % 25), static_cast<uint8_t>(1 + i % 12),
+                       static_cast<uint8_t>(1 + i % 28), 12, 30, 15, 500'000'000u);
+  std::vector<Time<scale::UTC>> out(kSamples);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSamples; ++i)
+      out[i] = Time<scale::UTC>::from_civil(civil[i]);
+    sink(out);
+  }
+  set_items(state);
+}
+
+void BM_ToCivil(benchmark::State &state) {
+  const auto utc = time_samples<scale::UTC>();
+  std::vector<CivilTime> out(kSamples);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSamples; ++i)
+      out[i] = utc[i].to_civil();
+    sink(out);
+  }
+  set_items(state);
+}
+
+// -- Scale pairs ---------------------------------------------------------------
+
+template <typename From, typename To> void BM_ScaleConvert(benchmark::State &state) {
+  const auto in = time_samples<From>();
+  std::vector<Time<To>> out(kSamples);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSamples; ++i)
+      out[i] = in[i].template to<To>();
+    sink(out);
+  }
+  set_items(state);
+}
+
+template <typename From, typename To> void BM_ScaleConvertUt1(benchmark::State &state) {
+  const auto ctx = TimeContext::with_builtin_eop();
+  const auto in = time_samples<From>();
+  std::vector<Time<To>> out(kSamples);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSamples; ++i)
+      out[i] = in[i].template to_with<To>(ctx);
+    sink(out);
+  }
+  set_items(state);
+}
+
+// -- Formats ---------------------------------------------------------------------
+
+template <typename S, typename F> void BM_Encode(benchmark::State &state) {
+  const auto in = time_samples<S>();
+  std::vector<EncodedTime<S, F>> out(kSamples);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSamples; ++i)
+      out[i] = in[i].template to<F>();
+    sink(out);
+  }
+  set_items(state);
+}
+
+template <typename S, typename F> void BM_Decode(benchmark::State &state) {
+  std::vector<EncodedTime<S, F>> in;
+  for (const auto &t : time_samples<S>())
+    in.push_back(t.template to<F>());
+  std::vector<Time<S>> out(kSamples);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSamples; ++i)
+      out[i] = Time<S>::from_encoded(in[i]);
+    sink(out);
+  }
+  set_items(state);
+}
+
+// -- GNSS weeks ------------------------------------------------------------------
+
+template <typename S> void BM_ToGnssWeek(benchmark::State &state) {
+  const auto in = time_samples<S>();
+  std::vector<GnssWeek> out(kSamples);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSamples; ++i)
+      out[i] = to_gnss_week(in[i]);
+    sink(out);
+  }
+  set_items(state);
+}
+
+template <typename S> void BM_FromGnssWeek(benchmark::State &state) {
+  std::vector<GnssWeek> in;
+  for (const auto &t : time_samples<S>())
+    in.push_back(to_gnss_week(t));
+  std::vector<Time<S>> out(kSamples);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < kSamples; ++i)
+      out[i] = from_gnss_week<S>(in[i]);
+    sink(out);
+  }
+  set_items(state);
+}
+
+} // namespace
+
+BENCHMARK(BM_FromSplitSeconds);
+BENCHMARK(BM_FromCivil);
+BENCHMARK(BM_ToCivil);
+
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::TT, scale::TAI);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::TT, scale::TCG);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::TT, scale::TDB);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::TT, scale::TCB);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::TT, scale::ET);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::TT, scale::GPST);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::TT, scale::GST);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::TT, scale::BDT);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::TT, scale::QZSST);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::TT, scale::UTC);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::UTC, scale::TT);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::UTC, scale::TAI);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::UTC, scale::GPST);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::UTC, scale::TDB);
+BENCHMARK_TEMPLATE(BM_ScaleConvert, scale::TDB, scale::TCB);
+BENCHMARK_TEMPLATE(BM_ScaleConvertUt1, scale::TT, scale::UT1);
+BENCHMARK_TEMPLATE(BM_ScaleConvertUt1, scale::UTC, scale::UT1);
+BENCHMARK_TEMPLATE(BM_ScaleConvertUt1, scale::UT1, scale::TT);
+
+BENCHMARK_TEMPLATE(BM_Encode, scale::TT, format::JD);
+BENCHMARK_TEMPLATE(BM_Encode, scale::TT, format::MJD);
+BENCHMARK_TEMPLATE(BM_Encode, scale::TT, format::J2000s);
+BENCHMARK_TEMPLATE(BM_Encode, scale::UTC, format::JD);
+BENCHMARK_TEMPLATE(BM_Encode, scale::UTC, format::Unix);
+BENCHMARK_TEMPLATE(BM_Encode, scale::TAI, format::GPS);
+BENCHMARK_TEMPLATE(BM_Decode, scale::TT, format::JD);
+BENCHMARK_TEMPLATE(BM_Decode, scale::TT, format::MJD);
+BENCHMARK_TEMPLATE(BM_Decode, scale::TT, format::J2000s);
+BENCHMARK_TEMPLATE(BM_Decode, scale::UTC, format::JD);
+BENCHMARK_TEMPLATE(BM_Decode, scale::UTC, format::Unix);
+BENCHMARK_TEMPLATE(BM_Decode, scale::TAI, format::GPS);
+
+BENCHMARK_TEMPLATE(BM_ToGnssWeek, scale::GPST);
+BENCHMARK_TEMPLATE(BM_ToGnssWeek, scale::GST);
+BENCHMARK_TEMPLATE(BM_ToGnssWeek, scale::BDT);
+BENCHMARK_TEMPLATE(BM_FromGnssWeek, scale::GPST);
+BENCHMARK_TEMPLATE(BM_FromGnssWeek, scale::BDT);
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Text export: `to_chars` / `to_chars_column` against iostream formatting.
+
+#include <benchmark/benchmark.h>
+#include <tempoch/tempoch.hpp>
+
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+constexpr std::size_t kRows = 4'096;
+
+std::vector<CivilTime> civil_rows() {
+  std::vector<CivilTime> out;
+  for (std::size_t i = 0; i < kRows; ++i)
+    out.emplace_back(2026, 7, 15, static_cast<uint8_t>(i / 3'600 % 24),
+                     static_cast<uint8_t>(i / 60 % 60), static_cast<uint8_t>(i % 60),
+                     static_cast<uint32_t>(i * 7'919 % 1'000'000'000));
+  return out;
+}
+
+std::vector<ModifiedJulianDate<scale::TT>> mjd_rows() {
+  std::vector<ModifiedJulianDate<scale::TT>> out;
+  for (std::size_t i = 0; i < kRows; ++i)
+    out.emplace_back(61'236.0 + static_cast<double>(i) / 86'400.0);
+  return out;
+}
+
+void BM_CivilToCharsColumn(benchmark::State &state) {
+  const auto rows = civil_rows();
+  std::vector<char> text(kRows * kIso8601MaxChars);
+  for (auto _ : state) {
+    auto r = to_chars_column(text.data(), text.data() + text.size(), span<const CivilTime>(rows));
+    benchmark::DoNotOptimize(r.ptr);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+
+void BM_CivilOstream(benchmark::State &state) {
+  const auto rows = civil_rows();
+  std::ostringstream os;
+  for (auto _ : state) {
+    os.str({});
+    for (const auto &c : rows)
+      os << c << '\n';
+    benchmark::DoNotOptimize(os.tellp());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+
+void BM_UtcToCharsColumn(benchmark::State &state) {
+  std::vector<Time<scale::UTC>> rows;
+  for (const auto &c : civil_rows())
+    rows.push_back(Time<scale::UTC>::from_civil(c));
+  std::vector<char> text(kRows * kIso8601MaxChars);
+  for (auto _ : state) {
+    auto r = to_chars_column(text.data(), text.data() + text.size(),
+                             span<const Time<scale::UTC>>(rows));
+    benchmark::DoNotOptimize(r.ptr);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+
+void BM_MjdToCharsColumn(benchmark::State &state) {
+  const auto rows = mjd_rows();
+  std::vector<char> text(kRows * kFixedDecimalMaxChars);
+  for (auto _ : state) {
+    auto r = to_chars_column(text.data(), text.data() + text.size(),
+                             span<const ModifiedJulianDate<scale::TT>>(rows), 9);
+    benchmark::DoNotOptimize(r.ptr);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+
+void BM_MjdOstream(benchmark::State &state) {
+  const auto rows = mjd_rows();
+  std::ostringstream os;
+  os << std::fixed << std::setprecision(9);
+  for (auto _ : state) {
+    os.str({});
+    for (const auto &mjd : rows)
+      os << mjd.raw().value() << '\n';
+    benchmark::DoNotOptimize(os.tellp());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * kRows));
+}
+
+} // namespace
+
+BENCHMARK(BM_CivilToCharsColumn);
+BENCHMARK(BM_CivilOstream);
+BENCHMARK(BM_UtcToCharsColumn);
+BENCHMARK(BM_MjdToCharsColumn);
+BENCHMARK(BM_MjdOstream);
@@ -0,0 +1,615 @@
+#pragma once
+
+/**
+ * @file arrow.hpp
+ * @brief Time columns through the Arrow C Data Interface.
+ *
+ * The Arrow C Data Interface is a plain C ABI (`ArrowSchema` / `ArrowArray`),
+ * so columns can move between tempoch and any Arrow engine (pyarrow, DuckDB,
+ * Polars, arrow-rs, ...) without linking Arrow.  The two structs are declared
+ * here unless an Arrow header already did so.
+ *
+ * Two kinds of columns are supported:
+ *
+ *   - `float64` columns of `EncodedTime<S, F>` values, tagged with the field
+ *     metadata `tempoch.scale` / `tempoch.format` (`"TT"` / `"MJD"`, ...).
+ *     They cross the boundary without copying: `export_arrow` hands Arrow the
+ *     vector's own buffer, and `import_arrow` returns an `ArrowColumn` that
+ *     reads the producer's buffer in place.
+ *   - `timestamp[ns]` columns of `Time<UTC>` (`"tsn:UTC"`, POSIX nanoseconds)
+ *     or `Time<TAI>` (`"tsn:"` tagged `tempoch.scale = TAI`, nanoseconds since
+ *     1970-01-01T00:00:00 TAI).  Nanosecond integers are a different
+ *     representation from the split seconds, so these are converted in one
+ *     pass, exactly to the nanosecond, without an `EncodedTime` per value.
+ *     Import also accepts `s`, `ms` and `us` timestamps.
+ *
+ * @code
+ * ArrowSchema schema;
+ * ArrowArray array;
+ * tempoch::export_arrow(std::move(mjd_column), &schema, &array, "epoch");  // zero-copy
+ * consumer.import(&schema, &array);  // e.g. pyarrow.Array._import_from_c
+ *
+ * auto column = tempoch::import_arrow<tempoch::scale::TT, tempoch::format::MJD>(&schema, &array);
+ * for (std::size_t i = 0; i < column.size(); ++i)
+ *   if (column.is_valid(i))
+ *     use(column.values()[i]);
+ * @endcode
+ *
+ * Import takes ownership of both structs: they are moved out of (their
+ * `release` set to null) and released when the result no longer needs them,
+ * also when the import throws.  Malformed or mismatched columns raise
+ * `TempochException`.
+ */
+
+#include "batch.hpp"
+#include "leap_table.hpp"
+#include "span.hpp"
+#include "split_arith.hpp"
+#include "time_base.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+
+struct ArrowSchema {
+  const char *format;
+  const char *name;
+  const char *metadata;
+  int64_t flags;
+  int64_t n_children;
+  struct ArrowSchema **children;
+  struct ArrowSchema *dictionary;
+  void (*release)(struct ArrowSchema *);
+  void *private_data;
+};
+
+struct ArrowArray {
+  int64_t length;
+  int64_t null_count;
+  int64_t offset;
+  int64_t n_buffers;
+  int64_t n_children;
+  const void **buffers;
+  struct ArrowArray **children;
+  struct ArrowArray *dictionary;
+  void (*release)(struct ArrowArray *);
+  void *private_data;
+};
+
+} // extern "C"
+
+#endif // ARROW_C_DATA_INTERFACE
+
+namespace tempoch {
+
+/// Field metadata key holding the scale name (`ScaleTraits<S>::name()`).
+inline constexpr std::string_view kArrowScaleKey = "tempoch.scale";
+/// Field metadata key holding the format name (`FormatTraits<F>::name()`).
+inline constexpr std::string_view kArrowFormatKey = "tempoch.format";
+
+/// Scales exchanged as Arrow `timestamp[ns]` columns.
+template <typename S>
+inline constexpr bool is_arrow_timestamp_scale_v =
+    std::is_same_v<S, scale::UTC> || std::is_same_v<S, scale::TAI>;
+
+namespace detail {
+
+/// Largest whole-second magnitude whose nanosecond count, plus a fraction, fits an int64.
+inline constexpr double kMaxArrowTimestampSeconds = 9'223'372'035.0;
+
+[[noreturn]] inline void arrow_error(const char *operation, const char *what) {
+  throw TempochException(std::string(operation) + " failed: " + what);
+}
+
+/// Arrow's binary metadata: int32 pair count, then length-prefixed keys and values.
+inline std::string arrow_metadata(std::string_view scale, std::string_view format) {
+  std::string out;
+  const auto put_int = [&out](int32_t v) {
+    char bytes[sizeof v];
+    std::memcpy(bytes, &v, sizeof v);
+    out.append(bytes, sizeof v);
+  };
+  const auto put_string = [&](std::string_view s) {
+    put_int(static_cast<int32_t>(s.size()));
+    out.append(s.data(), s.size());
+  };
+  put_int(format.empty() ? 1 : 2);
+  put_string(kArrowScaleKey);
+  put_string(scale);
+  if (!format.empty()) {
+    put_string(kArrowFormatKey);
+    put_string(format);
+  }
+  return out;
+}
+
+/// Value of @p key in Arrow binary @p metadata, if present.
+///
+/// Scanning stops at the first malformed entry: a negative count or size, or
+/// one that takes the blob past the int32 length Arrow allows.
+inline std::optional<std::string_view> find_arrow_metadata(const char *metadata,
+                                                           std::string_view key) noexcept {
+  if (metadata == nullptr)
+    return std::nullopt;
+  constexpr std::size_t kMaxBytes = static_cast<std::size_t>(INT32_MAX);
+  std::size_t consumed = 0;
+  const auto get_int = [&metadata, &consumed]() {
+    int32_t v = 0;
+    std::memcpy(&v, metadata, sizeof v);
+    metadata += sizeof v;
+    consumed += sizeof v;
+    return v;
+  };
+  // Bytes of a length-prefixed string, or false if the prefix is malformed.
+  const auto get_string = [&](std::string_view *out) {
+    if (kMaxBytes - consumed < sizeof(int32_t))
+      return false;
+    const int32_t size = get_int();
+    if (size < 0 || static_cast<std::size_t>(size) > kMaxBytes - consumed)
+      return false;
+    *out = std::string_view(metadata, static_cast<std::size_t>(size));
+    metadata += size;
+    consumed += static_cast<std::size_t>(size);
+    return true;
+  };
+  const int32_t pairs = get_int();
+  for (int32_t i = 0; i < pairs; ++i) {
+    std::string_view k;
+    std::string_view v;
+    if (!get_string(&k) || !get_string(&v))
+      return std::nullopt;
+    if (k == key)
+      return v;
+  }
+  return std::nullopt;
+}
+
+/// Strings an exported `ArrowSchema` points into.
+struct ArrowSchemaHolder {
+  std::string format;
+  std::string name;
+  std::string metadata;
+};
+
+inline void release_arrow_schema(ArrowSchema *schema) {
+  delete static_cast<ArrowSchemaHolder *>(schema->private_data);
+  schema->release = nullptr;
+}
+
+/// @p name may be null, which Arrow allows; it is exported as an empty name.
+inline void export_arrow_schema(ArrowSchema *out, std::string format, const char *name,
+                                std::string metadata) {
+  auto *holder = new ArrowSchemaHolder{std::move(format), name ? name : "", std::move(metadata)};
+  *out = ArrowSchema{};
+  out->format = holder->format.c_str();
+  out->name = holder->name.c_str();
+  out->metadata = holder->metadata.data();
+  out->flags = ARROW_FLAG_NULLABLE;
+  out->release = &release_arrow_schema;
+  out->private_data = holder;
+}
+
+/// Buffer list of an exported `ArrowArray`, plus whatever keeps the values alive.
+template <typename Storage> struct ArrowArrayHolder {
+  Storage storage;
+  const void *buffers[2] = {nullptr, nullptr};
+};
+
+template <typename Storage> inline void release_arrow_array(ArrowArray *array) {
+  delete static_cast<ArrowArrayHolder<Storage> *>(array->private_data);
+  array->release = nullptr;
+}
+
+/// Export a primitive array over @p values; @p storage is released with the array.
+template <typename Storage>
+inline void export_arrow_array(ArrowArray *out, Storage storage, const void *values,
+                               std::size_t length) {
+  auto *holder = new ArrowArrayHolder<Storage>{std::move(storage)};
+  holder->buffers[1] = values;
+  *out = ArrowArray{};
+  out->length = static_cast<int64_t>(length);
+  out->n_buffers = 2;
+  out->buffers = holder->buffers;
+  out->release = &release_arrow_array<Storage>;
+  out->private_data = holder;
+}
+
+/// Export @p schema and @p array together; the schema is released again if the array fails.
+template <typename Storage>
+inline void export_arrow_column(ArrowSchema *schema, ArrowArray *array, std::string format,
+                                const char *name, std::string metadata, Storage storage,
+                                const void *values, std::size_t length) {
+  export_arrow_schema(schema, std::move(format), name, std::move(metadata));
+  try {
+    export_arrow_array(array, std::move(storage), values, length);
+  } catch (...) {
+    schema->release(schema);
+    throw;
+  }
+}
+
+/// Owns an imported struct: moved out of the producer's copy, released on destruction.
+template <typename T> class ArrowImport {
+public:
+  explicit ArrowImport(T *source) noexcept : value_(*source) { source->release = nullptr; }
+  ArrowImport(const ArrowImport &) = delete;
+  ArrowImport &operator=(const ArrowImport &) = delete;
+  ArrowImport(ArrowImport &&other) noexcept : value_(other.value_) {
+    other.value_.release = nullptr;
+  }
+  ArrowImport &operator=(ArrowImport &&other) noexcept {
+    if (this != &other) {
+      reset();
+      value_ = other.value_;
+      other.value_.release = nullptr;
+    }
+    return *this;
+  }
+  ~ArrowImport() { reset(); }
+
+  const T &operator*() const noexcept { return value_; }
+  const T *operator->() const noexcept { return &value_; }
+
+private:
+  T value_;
+
+  void reset() noexcept {
+    if (value_.release != nullptr)
+      value_.release(&value_);
+  }
+};
+
+/// Check that @p array is a single primitive array of @p value_size-byte values.
+inline void check_arrow_array(const ArrowArray &array, std::size_t value_size,
+                              const char *operation) {
+  if (array.release == nullptr)
+    arrow_error(operation, "array is released");
+  if (array.n_buffers != 2 || array.n_children != 0 || array.dictionary != nullptr)
+    arrow_error(operation, "array is not a primitive column");
+  if (array.length < 0 || array.offset < 0)
+    arrow_error(operation, "negative length or offset");
+  if (array.length > 0 && array.buffers[1] == nullptr)
+    arrow_error(operation, "array has no value buffer");
+  if (reinterpret_cast<std::uintptr_t>(array.buffers[1]) % value_size != 0)
+    arrow_error(operation, "value buffer is misaligned");
+}
+
+inline void check_arrow_schema(const ArrowSchema &schema, const char *operation) {
+  if (schema.release == nullptr)
+    arrow_error(operation, "schema is released");
+  if (schema.n_children != 0 || schema.dictionary != nullptr)
+    arrow_error(operation, "schema is not a primitive column");
+}
+
+/// Whether slot @p i of @p array is non-null.
+inline bool arrow_is_valid(const ArrowArray &array, std::size_t i) noexcept {
+  const auto *validity = static_cast<const uint8_t *>(array.buffers[0]);
+  if (array.null_count == 0 || validity == nullptr)
+    return true;
+  const auto bit = static_cast<std::size_t>(array.offset) + i;
+  return (validity[bit / 8] >> (bit % 8)) & 1u;
+}
+
+/// Split seconds → integer nanoseconds, rounded half away from zero.
+///
+/// Integer casts instead of `floor` / `llround`, which are library calls on
+/// baseline x86-64 and dominate the per-value cost.
+inline bool split_to_nanos(const tempoch_time_t &value, int64_t *out) noexcept {
+  if (!(std::fabs(value.hi_seconds) <= kMaxArrowTimestampSeconds) ||
+      !is_finite(value.lo_seconds))
+    return false;
+  const auto seconds = static_cast<int64_t>(value.hi_seconds);
+  const double nanos =
+      ((value.hi_seconds - static_cast<double>(seconds)) + value.lo_seconds) * kNanosPerSecond;
+  *out = seconds * 1'000'000'000 + static_cast<int64_t>(nanos < 0.0 ? nanos - 0.5 : nanos + 0.5);
+  return true;
+}
+
+/// Seconds since 1970 on the Unix (UTC) or TAI axis, as a split pair.
+///
+/// UTC offsets come from @p leaps (the snapshot held for the whole column);
+/// instants it cannot answer go through tempoch-ffi.
+template <typename S>
+inline tempoch_status_t try_arrow_epoch_split(const tempoch_time_t &value, const LeapTable *leaps,
+                                              LeapCursor &cursor, tempoch_time_t *out) noexcept {
+  if constexpr (std::is_same_v<S, scale::TAI>) {
+    *out = split_add(value, -kUnixEpochUtcSeconds);
+    return TEMPOCH_STATUS_T_OK;
+  } else {
+    if (const LeapInterval *interval =
+            leaps ? leaps->find_utc(value.hi_seconds + value.lo_seconds, cursor.hint) : nullptr) {
+      *out = split_add(value, interval->unix_minus_utc);
+      return TEMPOCH_STATUS_T_OK;
+    }
+    // Outside the snapshot: encode the nearest whole Unix second through the
+    // engine and carry the remainder as an exact split difference.
+    double unix_seconds = 0.0;
+    tempoch_status_t s = try_encode_time<scale::UTC, format::Unix>(value, nullptr, &unix_seconds);
+    if (s != TEMPOCH_STATUS_T_OK)
+      return s;
+    const double whole = std::round(unix_seconds);
+    tempoch_time_t anchor{};
+    s = try_decode_time<scale::UTC, format::Unix>(whole, nullptr, &anchor);
+    if (s != TEMPOCH_STATUS_T_OK)
+      return s;
+    *out = split_add(make_split(whole, 0.0), split_difference(value, anchor));
+    return TEMPOCH_STATUS_T_OK;
+  }
+}
+
+/// Inverse of `try_arrow_epoch_split` for @p seconds whole seconds plus @p fraction.
+template <typename S>
+inline tempoch_status_t try_from_arrow_epoch(double seconds, double fraction,
+                                             const LeapTable *leaps, LeapCursor &cursor,
+                                             tempoch_time_t *out) noexcept {
+  if constexpr (std::is_same_v<S, scale::TAI>) {
+    *out = split_add(make_split(seconds + kUnixEpochUtcSeconds, 0.0), fraction);
+    return TEMPOCH_STATUS_T_OK;
+  } else {
+    if (const LeapInterval *interval = leaps ? leaps->find_unix(seconds, cursor.hint) : nullptr) {
+      *out = split_add(split_add(make_split(seconds, 0.0), -interval->unix_minus_utc), fraction);
+      return TEMPOCH_STATUS_T_OK;
+    }
+    tempoch_time_t anchor{};
+    const tempoch_status_t s = try_decode_time<scale::UTC, format::Unix>(seconds, nullptr, &anchor);
+    if (s != TEMPOCH_STATUS_T_OK)
+      return s;
+    *out = split_add(anchor, fraction);
+    return TEMPOCH_STATUS_T_OK;
+  }
+}
+
+/// Ticks per second of an Arrow timestamp format (`"ts?:zone"`), or 0 if not one.
+inline int64_t arrow_timestamp_ticks(std::string_view format) noexcept {
+  if (format.size() < 4 || format.substr(0, 2) != "ts" || format[3] != ':')
+    return 0;
+  switch (format[2]) {
+  case 's':
+    return 1;
+  case 'm':
+    return 1'000;
+  case 'u':
+    return 1'000'000;
+  case 'n':
+    return 1'000'000'000;
+  default:
+    return 0;
+  }
+}
+
+template <typename S, typename F> inline void check_encoded_layout() {
+  static_assert(std::is_trivially_copyable_v<EncodedTime<S, F>> &&
+                    sizeof(EncodedTime<S, F>) == sizeof(double) &&
+                    alignof(EncodedTime<S, F>) == alignof(double),
+                "EncodedTime<S, F> must have the layout of double to be shared with Arrow");
+}
+
+} // namespace detail
+
+// -- Export ----------------------------------------------------------------------
+
+/**
+ * @brief Export @p values as a tagged Arrow `float64` column, without copying.
+ *
+ * The array takes over the vector's buffer and frees it in its `release`
+ * callback.  @p schema and @p array must be uninitialised or released.
+ */
+template <typename S, typename F>
+inline void export_arrow(std::vector<EncodedTime<S, F>> values, ArrowSchema *schema,
+                         ArrowArray *array, const char *name = "") {
+  detail::check_encoded_layout<S, F>();
+  const void *data = values.data();
+  const std::size_t length = values.size();
+  detail::export_arrow_column(schema, array, "g", name,
+                              detail::arrow_metadata(ScaleTraits<S>::name(),
+                                                     FormatTraits<F>::name()),
+                              std::move(values), data, length);
+}
+
+/**
+ * @brief Export a borrowed view of @p values as a tagged Arrow `float64` column.
+ *
+ * Nothing is copied and nothing is owned: @p values must outlive every
+ * consumer of @p array.
+ */
+template <typename S, typename F>
+inline void export_arrow_view(span<const EncodedTime<S, F>> values, ArrowSchema *schema,
+                              ArrowArray *array, const char *name = "") {
+  detail::check_encoded_layout<S, F>();
+  detail::export_arrow_column(schema, array, "g", name,
+                              detail::arrow_metadata(ScaleTraits<S>::name(),
+                                                     FormatTraits<F>::name()),
+                              nullptr, values.data(), values.size());
+}
+
+/**
+ * @brief Export @p times as an Arrow `timestamp[ns]` column.
+ *
+ * UTC instants become `"tsn:UTC"` POSIX nanoseconds (a leap second shares
+ * its Unix value with the following second); TAI instants become `"tsn:"`
+ * nanoseconds since 1970-01-01T00:00:00 TAI, tagged `tempoch.scale = TAI`.
+ *
+ * @throws TempochException if an instant lies outside the int64 nanosecond
+ *         range (1677-2262) or UTC cannot label it.
+ */
+template <typename S, std::enable_if_t<is_arrow_timestamp_scale_v<S>, int> = 0>
+inline void export_arrow_timestamps(span<const Time<S>> times, ArrowSchema *schema,
+                                    ArrowArray *array, const char *name = "") {
+  constexpr const char *kOperation = "tempoch::export_arrow_timestamps";
+  detail::LeapCursor &cursor = detail::thread_leap_cursor();
+  const detail::LeapTable *leaps =
+      std::is_same_v<S, scale::UTC> ? detail::leap_table_for_thread(cursor) : nullptr;
+  std::vector<int64_t> nanos(times.size());
+  for (std::size_t i = 0; i < times.size(); ++i) {
+    tempoch_time_t since_epoch{};
+    const tempoch_status_t s =
+        detail::try_arrow_epoch_split<S>(times[i].c_inner(), leaps, cursor, &since_epoch);
+    if (s != TEMPOCH_STATUS_T_OK)
+      check_status(s, kOperation);
+    if (!detail::split_to_nanos(since_epoch, &nanos[i]))
+      detail::arrow_error(kOperation, "instant outside the timestamp[ns] range");
+  }
+  const void *data = nanos.data();
+  detail::export_arrow_column(schema, array, std::is_same_v<S, scale::UTC> ? "tsn:UTC" : "tsn:",
+                              name, detail::arrow_metadata(ScaleTraits<S>::name(), {}),
+                              std::move(nanos), data, times.size());
+}
+
+// -- Import ----------------------------------------------------------------------
+
+/**
+ * @brief An imported Arrow `float64` column read in place as `EncodedTime<S, F>`.
+ *
+ * Move-only; holds the producer's array until destroyed.  Null slots hold
+ * unspecified values, so check `is_valid(i)` when `null_count()` is non-zero.
+ */
+template <typename S, typename F> class ArrowColumn {
+public:
+  std::size_t size() const noexcept { return static_cast<std::size_t>(array_->length); }
+  bool empty() const noexcept { return size() == 0; }
+
+  /// Number of null slots; -1 if the producer did not compute it.
+  int64_t null_count() const noexcept { return array_->null_count; }
+  bool is_valid(std::size_t i) const noexcept { return detail::arrow_is_valid(*array_, i); }
+
+  /// The values, including null slots, in the producer's buffer.
+  span<const EncodedTime<S, F>> values() const noexcept {
+    return span<const EncodedTime<S, F>>(reinterpret_cast<const EncodedTime<S, F> *>(raw().data()),
+                                         size());
+  }
+
+  /// The same values as plain doubles, e.g. for `decode_column`.
+  span<const double> raw() const noexcept {
+    const auto *base = static_cast<const double *>(array_->buffers[1]);
+    return span<const double>(base == nullptr ? nullptr : base + array_->offset, size());
+  }
+
+  /// Decode every slot to `Time<S>`; null slots are reported as `TEMPOCH_STATUS_T_NULL_POINTER`.
+  TimeColumn<S> decode() const {
+    TimeColumn<S> column = decode_column<S, F>(raw());
+    if (null_count() != 0)
+      for (std::size_t i = 0; i < size(); ++i)
+        if (!is_valid(i)) {
+          column.times[i] = Time<S>();
+          column.status.set(i, TEMPOCH_STATUS_T_NULL_POINTER);
+        }
+    return column;
+  }
+
+private:
+  template <typename S2, typename F2>
+  friend ArrowColumn<S2, F2> import_arrow(ArrowSchema *schema, ArrowArray *array);
+
+  explicit ArrowColumn(detail::ArrowImport<ArrowArray> array) : array_(std::move(array)) {}
+
+  detail::ArrowImport<ArrowArray> array_;
+};
+
+/**
+ * @brief Import a tagged Arrow `float64` column without copying it.
+ *
+ * The column must be `"g"` with `tempoch.scale` / `tempoch.format` metadata
+ * naming @p S and @p F.  Both structs are consumed.
+ *
+ * @throws TempochException if the column has another type or tags.
+ */
+template <typename S, typename F>
+inline ArrowColumn<S, F> import_arrow(ArrowSchema *schema, ArrowArray *array) {
+  constexpr const char *kOperation = "tempoch::import_arrow";
+  detail::check_encoded_layout<S, F>();
+  const detail::ArrowImport<ArrowSchema> owned_schema(schema);
+  detail::ArrowImport<ArrowArray> owned_array(array);
+  detail::check_arrow_schema(*owned_schema, kOperation);
+  if (std::string_view(owned_schema->format) != "g")
+    detail::arrow_error(kOperation, "column is not float64");
+  if (detail::find_arrow_metadata(owned_schema->metadata, kArrowScaleKey) !=
+          std::string_view(ScaleTraits<S>::name()) ||
+      detail::find_arrow_metadata(owned_schema->metadata, kArrowFormatKey) !=
+          std::string_view(FormatTraits<F>::name()))
+    detail::arrow_error(kOperation, "column is not tagged with the requested scale and format");
+  detail::check_arrow_array(*owned_array, sizeof(double), kOperation);
+  return ArrowColumn<S, F>(std::move(owned_array));
+}
+
+/**
+ * @brief Import an Arrow timestamp column as `Time<S>` values.
+ *
+ * UTC accepts `"ts?:UTC"` (or `"ts?:+00:00"`) columns; TAI accepts
+ * timezone-less `"ts?:"` columns tagged `tempoch.scale = TAI`.  Any of the
+ * `s`, `ms`, `us` and `ns` units is accepted.  Null slots are reported as
+ * `TEMPOCH_STATUS_T_NULL_POINTER`.  Both structs are consumed.
+ *
+ * @throws TempochException if the column is not such a timestamp column.
+ */
+template <typename S, std::enable_if_t<is_arrow_timestamp_scale_v<S>, int> = 0>
+inline TimeColumn<S> import_arrow_timestamps(ArrowSchema *schema, ArrowArray *array) {
+  constexpr const char *kOperation = "tempoch::import_arrow_timestamps";
+  const detail::ArrowImport<ArrowSchema> owned_schema(schema);
+  const detail::ArrowImport<ArrowArray> owned_array(array);
+  detail::check_arrow_schema(*owned_schema, kOperation);
+  const std::string_view format(owned_schema->format);
+  const int64_t ticks = detail::arrow_timestamp_ticks(format);
+  if (ticks == 0)
+    detail::arrow_error(kOperation, "column is not a timestamp");
+  const std::string_view zone = format.substr(4);
+  const auto tag = detail::find_arrow_metadata(owned_schema->metadata, kArrowScaleKey);
+  if (tag && *tag != ScaleTraits<S>::name())
+    detail::arrow_error(kOperation, "column is tagged with another scale");
+  if constexpr (std::is_same_v<S, scale::UTC>) {
+    if (zone != "UTC" && zone != "+00:00")
+      detail::arrow_error(kOperation, "timestamp zone is not UTC");
+  } else {
+    if (!zone.empty() || !tag)
+      detail::arrow_error(kOperation, "timestamp is not tagged as TAI");
+  }
+  detail::check_arrow_array(*owned_array, sizeof(int64_t), kOperation);
+
+  const auto *values = static_cast<const int64_t *>(owned_array->buffers[1]);
+  const std::size_t n = static_cast<std::size_t>(owned_array->length);
+  detail::LeapCursor &cursor = detail::thread_leap_cursor();
+  const detail::LeapTable *leaps =
+      std::is_same_v<S, scale::UTC> ? detail::leap_table_for_thread(cursor) : nullptr;
+  TimeColumn<S> column;
+  column.times.resize(n);
+  column.status = BatchStatus(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    if (!detail::arrow_is_valid(*owned_array, i)) {
+      column.status.set(i, TEMPOCH_STATUS_T_NULL_POINTER);
+      continue;
+    }
+    const int64_t v = values[owned_array->offset + static_cast<int64_t>(i)];
+    int64_t seconds = v / ticks;
+    int64_t rest = v % ticks;
+    if (rest < 0) {
+      --seconds;
+      rest += ticks;
+    }
+    tempoch_time_t raw{};
+    const tempoch_status_t s = detail::try_from_arrow_epoch<S>(
+        static_cast<double>(seconds), static_cast<double>(rest) / static_cast<double>(ticks), leaps,
+        cursor, &raw);
+    if (s == TEMPOCH_STATUS_T_OK)
+      column.times[i] = Time<S>::from_c(raw);
+    else
+      column.status.set(i, s);
+  }
+  return column;
+}
+
+} // namespace tempoch
@@ -0,0 +1,496 @@
+#pragma once
+
+/**
+ * @file batch.hpp
+ * @brief Batch conversions over contiguous `Time<S>` arrays and raw value columns.
+ *
+ * The scalar API raises an exception on the first failing instant.  The batch
+ * entry points instead record one `tempoch_status_t` per element in a
+ * `BatchStatus`, so a handful of out-of-range epochs does not abort the whole
+ * block and the happy path never builds exception messages.
+ *
+ * `decode_column` / `encode_column` transcode plain `double` columns (Unix
+ * seconds, MJD, ...) without materialising an `EncodedTime` per value, and the
+ * span overloads of `from_civil` / `to_civil` handle civil UTC records.
+ *
+ * @code
+ * std::vector<tempoch::Time<tempoch::scale::UTC>> utc = load_stamps();
+ * std::vector<tempoch::Time<tempoch::scale::TT>> tt(utc.size());
+ * auto status = tempoch::convert<tempoch::scale::UTC, tempoch::scale::TT>(utc, tt);
+ * if (!status.all_ok())
+ *     std::cerr << status.failed() << " stamps could not be converted\n";
+ * @endcode
+ */
+
+#include "span.hpp"
+#include "time_base.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace tempoch {
+
+/**
+ * @brief Per-element outcome of a batch operation.
+ *
+ * Element `i` succeeded when `ok(i)` is true; otherwise `status(i)` carries the
+ * tempoch-ffi status code the scalar API would have raised for it.
+ */
+class BatchStatus {
+  std::vector<tempoch_status_t> codes_;
+  std::size_t failed_ = 0;
+
+public:
+  BatchStatus() = default;
+
+  explicit BatchStatus(std::size_t count) : codes_(count, TEMPOCH_STATUS_T_OK) {}
+
+  /// Record the outcome of element @p i.
+  void set(std::size_t i, tempoch_status_t status) noexcept {
+    if (codes_[i] == TEMPOCH_STATUS_T_OK && status != TEMPOCH_STATUS_T_OK)
+      ++failed_;
+    else if (codes_[i] != TEMPOCH_STATUS_T_OK && status == TEMPOCH_STATUS_T_OK)
+      --failed_;
+    codes_[i] = status;
+  }
+
+  std::size_t size() const noexcept { return codes_.size(); }
+  std::size_t failed() const noexcept { return failed_; }
+  bool all_ok() const noexcept { return failed_ == 0; }
+
+  bool ok(std::size_t i) const noexcept { return codes_[i] == TEMPOCH_STATUS_T_OK; }
+  tempoch_status_t status(std::size_t i) const noexcept { return codes_[i]; }
+  tempoch_status_t operator[](std::size_t i) const noexcept { return codes_[i]; }
+
+  const std::vector<tempoch_status_t> &codes() const noexcept { return codes_; }
+
+  /// One byte per element: 1 where the element succeeded, 0 where it failed.
+  std::vector<uint8_t> validity_mask() const {
+    std::vector<uint8_t> mask(codes_.size());
+    for (std::size_t i = 0; i < codes_.size(); ++i)
+      mask[i] = codes_[i] == TEMPOCH_STATUS_T_OK ? 1 : 0;
+    return mask;
+  }
+
+  /// Index of the first failed element, or `size()` when every element succeeded.
+  std::size_t first_failure() const noexcept {
+    if (failed_ == 0)
+      return codes_.size();
+    return static_cast<std::size_t>(
+        std::find_if(codes_.begin(), codes_.end(),
+                     [](tempoch_status_t s) { return s != TEMPOCH_STATUS_T_OK; }) -
+        codes_.begin());
+  }
+
+  /// Throw the exception the scalar API would have raised for the first failure.
+  void check(const char *operation) const {
+    const std::size_t i = first_failure();
+    if (i < codes_.size())
+      check_status(codes_[i], operation);
+  }
+};
+
+namespace detail {
+
+inline void ensure_same_length(std::size_t in, std::size_t out, const char *operation) {
+  if (in != out)
+    throw TempochException(std::string(operation) + " failed: output length " +
+                           std::to_string(out) + " does not match input length " +
+                           std::to_string(in));
+}
+
+template <typename From, typename To>
+inline BatchStatus convert_batch(span<const Time<From>> in, span<Time<To>> out,
+                                 const tempoch_context_t *ctx) {
+  ensure_same_length(in.size(), out.size(), "tempoch::convert");
+  BatchStatus status(in.size());
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    tempoch_time_t raw{};
+    const tempoch_status_t s = try_scale_convert<From, To>(in[i].c_inner(), ctx, &raw);
+    if (s == TEMPOCH_STATUS_T_OK)
+      out[i] = Time<To>::from_c(raw);
+    else
+      status.set(i, s);
+  }
+  return status;
+}
+
+template <typename S, typename F>
+inline tempoch_status_t try_decode_value(double raw, const tempoch_context_t *ctx,
+                                         tempoch_time_t *out) noexcept {
+  // Mirrors the finiteness check done by the EncodedTime constructors.
+  if (!std::isfinite(raw))
+    return TEMPOCH_STATUS_T_CONVERSION_FAILED;
+  return try_decode_time<S, F>(raw, ctx, out);
+}
+
+template <typename S, typename F>
+inline BatchStatus decode_batch(span<const double> raw, span<Time<S>> out,
+                                const tempoch_context_t *ctx) {
+  ensure_same_length(raw.size(), out.size(), "tempoch::decode_column");
+  BatchStatus status(raw.size());
+  for (std::size_t i = 0; i < raw.size(); ++i) {
+    tempoch_time_t t{};
+    const tempoch_status_t s = try_decode_value<S, F>(raw[i], ctx, &t);
+    if (s == TEMPOCH_STATUS_T_OK)
+      out[i] = Time<S>::from_c(t);
+    else
+      status.set(i, s);
+  }
+  return status;
+}
+
+template <typename S, typename F>
+inline BatchStatus encode_batch(span<const Time<S>> in, span<double> out,
+                                const tempoch_context_t *ctx) {
+  ensure_same_length(in.size(), out.size(), "tempoch::encode_column");
+  BatchStatus status(in.size());
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const tempoch_status_t s = try_encode_time<S, F>(in[i].c_inner(), ctx, &out[i]);
+    if (s != TEMPOCH_STATUS_T_OK) {
+      out[i] = std::numeric_limits<double>::quiet_NaN();
+      status.set(i, s);
+    }
+  }
+  return status;
+}
+
+} // namespace detail
+
+/**
+ * @brief A decoded column of instants on scale @p S with per-element status.
+ *
+ * `times[i]` is meaningful only when `status.ok(i)`; slots whose source value
+ * failed to decode hold the J2000 origin.
+ */
+template <typename S> struct TimeColumn {
+  std::vector<Time<S>> times;
+  BatchStatus status;
+
+  std::size_t size() const noexcept { return times.size(); }
+  const Time<S> &operator[](std::size_t i) const noexcept { return times[i]; }
+};
+
+/**
+ * @brief Convert a block of instants from scale @p From to scale @p To.
+ *
+ * @p out must have the same length as @p in.  Elements that fail to convert
+ * are left unmodified in @p out and reported through the returned status;
+ * no exception is thrown for per-element failures.
+ *
+ * Uses the default conversion policy, so UT1 routes are rejected at compile
+ * time exactly like `Time<S>::to<T>()`; use the `TimeContext` overload for them.
+ */
+template <typename From, typename To,
+          std::enable_if_t<is_scale_v<From> && is_scale_v<To> &&
+                               !std::is_same_v<From, scale::UT1> && !std::is_same_v<To, scale::UT1>,
+                           int> = 0>
+inline BatchStatus convert(span<const Time<From>> in, span<Time<To>> out) {
+  return detail::convert_batch<From, To>(in, out, nullptr);
+}
+
+/// Convert a block of instants using the UTC / UT1 policy carried by @p ctx.
+template <typename From, typename To,
+          std::enable_if_t<is_scale_v<From> && is_scale_v<To>, int> = 0>
+inline BatchStatus convert(span<const Time<From>> in, span<Time<To>> out, const TimeContext &ctx) {
+  return detail::convert_batch<From, To>(in, out, ctx.get());
+}
+
+// ============================================================================
+// Columnar encode / decode
+// ============================================================================
+
+/**
+ * @brief Decode a column of raw values in format @p F into caller storage.
+ *
+ * Non-finite inputs are reported as `TEMPOCH_STATUS_T_CONVERSION_FAILED`, the
+ * status the `EncodedTime` constructors raise for them.  Failed slots of
+ * @p out are left unmodified.
+ */
+template <typename S, typename F, std::enable_if_t<is_scale_v<S> && is_format_v<F>, int> = 0>
+inline BatchStatus decode_column(span<const double> raw, span<Time<S>> out) {
+  return detail::decode_batch<S, F>(raw, out, nullptr);
+}
+
+/// Decode into caller storage using the UTC / UT1 policy carried by @p ctx.
+template <typename S, typename F, std::enable_if_t<is_scale_v<S> && is_format_v<F>, int> = 0>
+inline BatchStatus decode_column(span<const double> raw, span<Time<S>> out,
+                                 const TimeContext &ctx) {
+  return detail::decode_batch<S, F>(raw, out, ctx.get());
+}
+
+namespace detail {
+
+template <typename S, typename F>
+inline TimeColumn<S> decode_column_owned(span<const double> raw, const tempoch_context_t *ctx) {
+  TimeColumn<S> column;
+  column.times.reserve(raw.size());
+  column.status = BatchStatus(raw.size());
+  for (std::size_t i = 0; i < raw.size(); ++i) {
+    tempoch_time_t t{};
+    const tempoch_status_t s = try_decode_value<S, F>(raw[i], ctx, &t);
+    if (s != TEMPOCH_STATUS_T_OK) {
+      column.status.set(i, s);
+      t = tempoch_time_t{};
+    }
+    column.times.push_back(Time<S>::from_c(t));
+  }
+  return column;
+}
+
+} // namespace detail
+
+/**
+ * @brief Decode a column of raw values in format @p F into a new `TimeColumn`.
+ *
+ * @code
+ * std::vector<double> unix_seconds = read_parquet_column("ts");
+ * auto column = tempoch::decode_column<tempoch::scale::UTC, tempoch::format::Unix>(unix_seconds);
+ * @endcode
+ */
+template <typename S, typename F, std::enable_if_t<is_scale_v<S> && is_format_v<F>, int> = 0>
+inline TimeColumn<S> decode_column(span<const double> raw) {
+  return detail::decode_column_owned<S, F>(raw, nullptr);
+}
+
+/// Decode into a new `TimeColumn` using the UTC / UT1 policy carried by @p ctx.
+template <typename S, typename F, std::enable_if_t<is_scale_v<S> && is_format_v<F>, int> = 0>
+inline TimeColumn<S> decode_column(span<const double> raw, const TimeContext &ctx) {
+  return detail::decode_column_owned<S, F>(raw, ctx.get());
+}
+
+/**
+ * @brief Encode a block of instants into raw values of format @p F.
+ *
+ * Slots that fail to encode are set to NaN and flagged in the returned status.
+ */
+template <typename S, typename F, std::enable_if_t<is_scale_v<S> && is_format_v<F>, int> = 0>
+inline BatchStatus encode_column(span<const Time<S>> times, span<double> out) {
+  return detail::encode_batch<S, F>(times, out, nullptr);
+}
+
+/// Encode into caller storage using the UTC / UT1 policy carried by @p ctx.
+template <typename S, typename F, std::enable_if_t<is_scale_v<S> && is_format_v<F>, int> = 0>
+inline BatchStatus encode_column(span<const Time<S>> times, span<double> out,
+                                 const TimeContext &ctx) {
+  return detail::encode_batch<S, F>(times, out, ctx.get());
+}
+
+/// Encode a block of instants into a new column; failed slots hold NaN.
+template <typename S, typename F, std::enable_if_t<is_scale_v<S> && is_format_v<F>, int> = 0>
+inline std::vector<double> encode_column(span<const Time<S>> times) {
+  std::vector<double> out(times.size());
+  detail::encode_batch<S, F>(times, out, nullptr);
+  return out;
+}
+
+/// Encode into a new column using the UTC / UT1 policy carried by @p ctx.
+template <typename S, typename F, std::enable_if_t<is_scale_v<S> && is_format_v<F>, int> = 0>
+inline std::vector<double> encode_column(span<const Time<S>> times, const TimeContext &ctx) {
+  std::vector<double> out(times.size());
+  detail::encode_batch<S, F>(times, out, ctx.get());
+  return out;
+}
+
+// ============================================================================
+// Civil UTC batches
+// ============================================================================
+
+namespace detail {
+
+/// First civil year after which UTC seconds are SI seconds with integral leaps.
+inline constexpr int32_t kIntegralLeapSecondEpochYear = 1972;
+
+inline constexpr double kSecondsPerDay = 86'400.0;
+inline constexpr double kNanosPerSecond = 1.0e9;
+
+/// Split storage of one civil UTC midnight, reused while the batch stays on that day.
+///
+/// Within a post-1972 UTC day the split value is affine in the civil seconds of
+/// day; only the final second can be a leap second, so the fast paths below
+/// stay strictly away from it and hand such records to tempoch-ffi.
+struct CivilDayAnchor {
+  int32_t year = 0;
+  uint8_t month = 0;
+  uint8_t day = 0;
+  bool valid = false;
+  tempoch_time_t midnight{};
+
+  bool same_day(const CivilTime &c) const noexcept {
+    return valid && c.year == year && c.month == month && c.day == day;
+  }
+
+  void reset(const CivilTime &c, const tempoch_context_t *ctx) noexcept {
+    valid = false;
+    if (c.year < kIntegralLeapSecondEpochYear)
+      return;
+    if (try_time_from_civil(CivilTime(c.year, c.month, c.day), ctx, &midnight) !=
+        TEMPOCH_STATUS_T_OK)
+      return;
+    year = c.year;
+    month = c.month;
+    day = c.day;
+    valid = true;
+  }
+
+  /// Day of the last record tempoch-ffi broke down, not resolved into `midnight` yet.
+  CivilTime pending;
+  bool has_pending = false;
+  /// Approximate split seconds of `pending`'s midnight, only used to spot a second record on it.
+  double pending_midnight = 0.0;
+
+  void defer(const CivilTime &c, const tempoch_time_t &t) noexcept {
+    has_pending = c.year >= kIntegralLeapSecondEpochYear;
+    pending = CivilTime(c.year, c.month, c.day);
+    pending_midnight = (t.hi_seconds + t.lo_seconds) -
+                       (c.hour * 3'600.0 + c.minute * 60.0 + c.second +
+                        c.nanosecond / kNanosPerSecond);
+  }
+
+  /// Resolve the pending day once a second record lands on it, so that a run of
+  /// records costs one extra tempoch-ffi call while isolated records cost none.
+  bool adopt_pending(const tempoch_time_t &t, const tempoch_context_t *ctx) noexcept {
+    if (!has_pending)
+      return false;
+    const double delta = (t.hi_seconds + t.lo_seconds) - pending_midnight;
+    if (!(delta >= 0.0 && delta < kSecondsPerDay - 1.0))
+      return false;
+    has_pending = false;
+    reset(pending, ctx);
+    return valid;
+  }
+};
+
+inline bool civil_fields_in_range(const CivilTime &c) noexcept {
+  return c.hour < 24 && c.minute < 60 && c.second < 60 && c.nanosecond < 1'000'000'000u;
+}
+
+inline tempoch_status_t from_civil_cached(const CivilTime &c, const tempoch_context_t *ctx,
+                                          CivilDayAnchor &anchor, tempoch_time_t *out) noexcept {
+  if (civil_fields_in_range(c)) {
+    if (!anchor.same_day(c))
+      anchor.reset(c, ctx);
+    if (anchor.same_day(c)) {
+      const double second_of_day = c.hour * 3'600.0 + c.minute * 60.0 + c.second;
+      *out = split_add(split_add(anchor.midnight, second_of_day), c.nanosecond / kNanosPerSecond);
+      return TEMPOCH_STATUS_T_OK;
+    }
+  }
+  return try_time_from_civil(c, ctx, out);
+}
+
+/// Break @p t down against the anchored midnight; false if it is not on that day.
+inline bool civil_from_anchor(const tempoch_time_t &t, const CivilDayAnchor &anchor,
+                              CivilTime *out) noexcept {
+  if (!anchor.valid)
+    return false;
+  // The last second of the day may be a leap second; leave it to tempoch-ffi.
+  const double delta = split_difference(t, anchor.midnight);
+  if (!(delta >= 0.0 && delta < kSecondsPerDay - 1.0))
+    return false;
+  double whole = std::floor(delta);
+  auto nanos = static_cast<uint32_t>(std::llround((delta - whole) * kNanosPerSecond));
+  if (nanos >= 1'000'000'000u) {
+    nanos -= 1'000'000'000u;
+    whole += 1.0;
+  }
+  const auto sod = static_cast<uint32_t>(whole);
+  *out = CivilTime(anchor.year, anchor.month, anchor.day, static_cast<uint8_t>(sod / 3'600),
+                   static_cast<uint8_t>(sod / 60 % 60), static_cast<uint8_t>(sod % 60), nanos);
+  return true;
+}
+
+inline tempoch_status_t to_civil_cached(const tempoch_time_t &t, const tempoch_context_t *ctx,
+                                        CivilDayAnchor &anchor, CivilTime *out) noexcept {
+  if (civil_from_anchor(t, anchor, out) ||
+      (anchor.adopt_pending(t, ctx) && civil_from_anchor(t, anchor, out)))
+    return TEMPOCH_STATUS_T_OK;
+  const tempoch_status_t status = try_time_to_civil(t, ctx, out);
+  if (status == TEMPOCH_STATUS_T_OK && out->second < 60)
+    anchor.defer(*out, t);
+  return status;
+}
+
+inline BatchStatus from_civil_batch(span<const CivilTime> civil, span<Time<scale::UTC>> out,
+                                    const tempoch_context_t *ctx) {
+  ensure_same_length(civil.size(), out.size(), "tempoch::from_civil");
+  BatchStatus status(civil.size());
+  CivilDayAnchor anchor;
+  for (std::size_t i = 0; i < civil.size(); ++i) {
+    tempoch_time_t t{};
+    const tempoch_status_t s = from_civil_cached(civil[i], ctx, anchor, &t);
+    if (s == TEMPOCH_STATUS_T_OK)
+      out[i] = Time<scale::UTC>::from_c(t);
+    else
+      status.set(i, s);
+  }
+  return status;
+}
+
+inline BatchStatus to_civil_batch(span<const Time<scale::UTC>> times, span<CivilTime> out,
+                                  const tempoch_context_t *ctx) {
+  ensure_same_length(times.size(), out.size(), "tempoch::to_civil");
+  BatchStatus status(times.size());
+  CivilDayAnchor anchor;
+  for (std::size_t i = 0; i < times.size(); ++i) {
+    CivilTime c;
+    const tempoch_status_t s = to_civil_cached(times[i].c_inner(), ctx, anchor, &c);
+    if (s == TEMPOCH_STATUS_T_OK)
+      out[i] = c;
+    else
+      status.set(i, s);
+  }
+  return status;
+}
+
+} // namespace detail
+
+/**
+ * @brief Convert a block of civil UTC records to `Time<scale::UTC>`.
+ *
+ * Records are processed in order and the split value of the current civil
+ * midnight is reused while consecutive records stay on the same post-1972 UTC
+ * day, so time-sorted input costs one tempoch-ffi call per day rather than per
+ * record.  Leap-second labels (`:60`), pre-1972 dates and malformed fields go
+ * through tempoch-ffi individually.  `status.validity_mask()` yields the
+ * per-record validity mask; failed slots of @p out are left unmodified.
+ *
+ * The native path adds the seconds of day to the midnight with compensated
+ * sums, so a record can differ from the scalar `Time::from_civil` in the last
+ * bits of the split pair, far below a nanosecond.
+ */
+inline BatchStatus from_civil(span<const CivilTime> civil, span<Time<scale::UTC>> out) {
+  return detail::from_civil_batch(civil, out, nullptr);
+}
+
+/// Civil batch conversion using the historical-UTC policy carried by @p ctx.
+inline BatchStatus from_civil(span<const CivilTime> civil, span<Time<scale::UTC>> out,
+                              const TimeContext &ctx) {
+  return detail::from_civil_batch(civil, out, ctx.get());
+}
+
+/**
+ * @brief Convert a block of `Time<scale::UTC>` instants to civil UTC records.
+ *
+ * Mirrors the span overload of `from_civil`: instants falling before the last
+ * second of the most recently resolved UTC day are broken down natively (to the
+ * nearest nanosecond); everything else goes through tempoch-ffi.  A day is
+ * resolved (one `tempoch_time_from_civil` call) only once a second instant
+ * lands on it, so unsorted input costs one tempoch-ffi call per record.
+ */
+inline BatchStatus to_civil(span<const Time<scale::UTC>> times, span<CivilTime> out) {
+  return detail::to_civil_batch(times, out, nullptr);
+}
+
+/// Civil batch breakdown using the historical-UTC policy carried by @p ctx.
+inline BatchStatus to_civil(span<const Time<scale::UTC>> times, span<CivilTime> out,
+                            const TimeContext &ctx) {
+  return detail::to_civil_batch(times, out, ctx.get());
+}
+
+} // namespace tempoch
@@ -0,0 +1,132 @@
+#pragma once
+
+/**
+ * @file clock.hpp
+ * @brief System clock readings behind `Time<UTC>::now()` and `Time<TAI>::now()`.
+ *
+ * The wall clock is read with `clock_gettime(CLOCK_REALTIME)`, which Linux
+ * serves from the vDSO without a system call (`std::chrono::system_clock`
+ * elsewhere).  Its POSIX seconds are turned into UTC split storage through
+ * the leap-second snapshot (leap_table.hpp), so once it is built a stamp
+ * costs no tempoch-ffi call away from leap-second edges.  Each thread keeps the split value of the
+ * last whole second it stamped, so stamps within one second skip even the
+ * snapshot lookup.
+ *
+ * `Time<TAI>::now()` reads `CLOCK_TAI` directly when the kernel TAI offset
+ * has been set (by chrony, ntpd or ptp4l) and agrees with the snapshot.  The
+ * check runs once per `kKernelTaiRecheckInterval` stamps per thread, and
+ * again whenever the snapshot changes; otherwise TAI is derived from the UTC
+ * stamp.
+ */
+
+#include "leap_table.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <ctime>
+
+namespace tempoch {
+namespace detail {
+
+/// Whole seconds and nanoseconds since a clock's 1970 epoch.
+struct ClockReading {
+  int64_t seconds = 0;
+  int64_t nanoseconds = 0;
+};
+
+/// POSIX time: seconds since 1970-01-01T00:00:00 UTC, leap seconds not counted.
+inline ClockReading read_unix_clock() noexcept {
+#if defined(CLOCK_REALTIME)
+  timespec ts{};
+  ::clock_gettime(CLOCK_REALTIME, &ts);
+  return {static_cast<int64_t>(ts.tv_sec), static_cast<int64_t>(ts.tv_nsec)};
+#else
+  const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count();
+  int64_t seconds = ns / 1'000'000'000;
+  int64_t rest = ns % 1'000'000'000;
+  if (rest < 0) {
+    --seconds;
+    rest += 1'000'000'000;
+  }
+  return {seconds, rest};
+#endif
+}
+
+/// UTC split storage of the last whole POSIX second stamped on this thread.
+///
+/// Stamps taken within the same second only add their nanoseconds to it.  The
+/// entry is keyed on the leap-table generation as well, so
+/// `refresh_leap_table()` takes effect on the next stamp.
+struct UnixSecondCache {
+  int64_t seconds = 0;
+  uint64_t generation = ~uint64_t{0};
+  tempoch_time_t utc{};
+};
+
+inline UnixSecondCache &thread_unix_second_cache() noexcept {
+  thread_local UnixSecondCache cache;
+  return cache;
+}
+
+#if defined(CLOCK_TAI)
+
+/// `Time<TAI>::now()` calls per thread between two kernel TAI offset checks.
+inline constexpr uint32_t kKernelTaiRecheckInterval = 1u << 16;
+
+/// Whether `CLOCK_TAI − CLOCK_REALTIME` matches TAI − UTC from the leap-second snapshot.
+///
+/// A kernel whose TAI offset was never set reports 0, so `CLOCK_TAI` then
+/// runs on UTC and must not be used.
+inline bool kernel_tai_offset_matches() noexcept {
+  timespec realtime{};
+  timespec tai{};
+  if (::clock_gettime(CLOCK_REALTIME, &realtime) != 0 || ::clock_gettime(CLOCK_TAI, &tai) != 0)
+    return false;
+  const double offset = static_cast<double>(tai.tv_sec - realtime.tv_sec) +
+                        static_cast<double>(tai.tv_nsec - realtime.tv_nsec) * 1.0e-9;
+  const auto unix_seconds = static_cast<double>(realtime.tv_sec);
+  double unix_minus_utc = 0.0;
+  double tai_minus_utc = 0.0;
+  if (!leap_unix_minus_utc_from_unix(unix_seconds, &unix_minus_utc) ||
+      !leap_tai_minus_utc(unix_seconds - unix_minus_utc, &tai_minus_utc))
+    return false;
+  return tai_minus_utc != 0.0 && std::fabs(offset - tai_minus_utc) < 0.5;
+}
+
+/// Per-thread verdict of `kernel_tai_offset_matches`, rechecked periodically.
+struct KernelTaiCheck {
+  uint32_t countdown = 0;
+  uint64_t generation = ~uint64_t{0};
+  bool usable = false;
+};
+
+#endif
+
+/// `CLOCK_TAI` (seconds since 1970-01-01T00:00:00 TAI), if the kernel offset can be trusted.
+inline bool read_kernel_tai_clock(ClockReading *out) noexcept {
+#if defined(CLOCK_TAI)
+  thread_local KernelTaiCheck check;
+  const uint64_t generation =
+      LeapTableRegistry::instance().generation.load(std::memory_order_acquire);
+  if (check.countdown == 0 || check.generation != generation) {
+    check.usable = kernel_tai_offset_matches();
+    check.countdown = kKernelTaiRecheckInterval;
+    check.generation = generation;
+  }
+  --check.countdown;
+  timespec ts{};
+  if (!check.usable || ::clock_gettime(CLOCK_TAI, &ts) != 0)
+    return false;
+  *out = {static_cast<int64_t>(ts.tv_sec), static_cast<int64_t>(ts.tv_nsec)};
+  return true;
+#else
+  (void)out;
+  return false;
+#endif
+}
+
+} // namespace detail
+} // namespace tempoch
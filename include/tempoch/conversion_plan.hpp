@@ -0,0 +1,223 @@
+#pragma once
+
+/**
+ * @file conversion_plan.hpp
+ * @brief Pre-resolved conversion routes for hot loops.
+ *
+ * A `ConversionPlan<FromScale, FromFormat, ToScale, ToFormat>` fixes the whole
+ * decode → scale → encode route at compile time and pins the `TimeContext`
+ * once, so applying it to an element runs only the steps the route needs.
+ * Passing `void` as a format means the plain split `Time<S>` on that side.
+ *
+ * @code
+ * using tempoch::scale::UTC; using tempoch::scale::TT;
+ * const tempoch::ConversionPlan<UTC, tempoch::format::Unix, TT, tempoch::format::JD> plan;
+ * std::vector<double> jd(unix_seconds.size());
+ * tempoch::BatchStatus status = plan(unix_seconds, jd);   // failed slots hold NaN
+ * @endcode
+ *
+ * The `native_*` flags report which steps are resolved in the header.  Steps
+ * that are not native may still avoid tempoch-ffi at run time: UTC ↔ TAI goes
+ * through the leap-second snapshot (see leap_table.hpp) whenever it can, unless the
+ * plan holds a non-default `TimeContext`.
+ */
+
+#include "batch.hpp"
+#include "result.hpp"
+#include "span.hpp"
+#include "time_base.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace tempoch {
+
+namespace detail {
+
+template <typename S, typename F> struct PlanEndpoint {
+  static_assert(is_format_v<F>, "ConversionPlan formats must be tempoch::format tags or void");
+  using type = EncodedTime<S, F>;
+  using raw_type = double;
+};
+
+template <typename S> struct PlanEndpoint<S, void> {
+  using type = Time<S>;
+  using raw_type = tempoch_time_t;
+};
+
+} // namespace detail
+
+/**
+ * @brief A fixed `EncodedTime<FromScale, FromFormat>` → `EncodedTime<ToScale, ToFormat>` route.
+ *
+ * Use `void` for @p FromFormat / @p ToFormat to read or produce `Time<S>`.
+ */
+template <typename FromScale, typename FromFormat, typename ToScale, typename ToFormat>
+class ConversionPlan {
+  static_assert(is_scale_v<FromScale> && is_scale_v<ToScale>,
+                "ConversionPlan requires tempoch::scale tags");
+
+  static constexpr bool from_time = std::is_void_v<FromFormat>;
+  static constexpr bool to_time = std::is_void_v<ToFormat>;
+  static constexpr bool needs_context =
+      std::is_same_v<FromScale, scale::UT1> || std::is_same_v<ToScale, scale::UT1>;
+
+public:
+  using input_type = typename detail::PlanEndpoint<FromScale, FromFormat>::type;
+  using output_type = typename detail::PlanEndpoint<ToScale, ToFormat>::type;
+  using input_raw_type = typename detail::PlanEndpoint<FromScale, FromFormat>::raw_type;
+  using output_raw_type = typename detail::PlanEndpoint<ToScale, ToFormat>::raw_type;
+
+  /// Same scale, and the format change is a header-only transcode: no split is built.
+  static constexpr bool direct_transcode = [] {
+    if constexpr (!from_time && !to_time && std::is_same_v<FromScale, ToScale>)
+      return std::is_same_v<FromFormat, ToFormat> ||
+             detail::has_native_format_route_v<FromScale, FromFormat, ToFormat>;
+    else
+      return false;
+  }();
+  static constexpr bool native_decode = [] {
+    if constexpr (from_time)
+      return true;
+    else
+      return detail::has_native_split_codec_v<FromScale, FromFormat> ||
+             detail::has_gps_seconds_route_v<FromScale, FromFormat>;
+  }();
+  static constexpr bool native_scale =
+      std::is_same_v<FromScale, ToScale> || detail::has_native_scale_route_v<FromScale, ToScale>;
+  static constexpr bool native_encode = [] {
+    if constexpr (to_time)
+      return true;
+    else
+      return detail::has_native_split_codec_v<ToScale, ToFormat> ||
+             detail::has_gps_seconds_route_v<ToScale, ToFormat>;
+  }();
+  /// True when no step of the route can reach tempoch-ffi.
+  static constexpr bool fully_native =
+      direct_transcode || (native_decode && native_scale && native_encode);
+
+  /// Plan using the default conversion policy; unavailable for UT1 routes.
+  template <bool Enabled = !needs_context, std::enable_if_t<Enabled, int> = 0>
+  ConversionPlan() noexcept {}
+
+  /// Plan pinned to the UTC / UT1 policy of @p ctx (shared, not copied).
+  explicit ConversionPlan(TimeContext ctx) : ctx_(std::move(ctx)), raw_ctx_(ctx_->get()) {}
+
+  /// Convert one element, throwing the mapped `TempochException` on failure.
+  output_type operator()(const input_type &in) const {
+    output_raw_type out{};
+    const char *operation = "";
+    check_status(apply(to_raw(in), &out, &operation), operation);
+    return from_raw(out);
+  }
+
+  /// Convert one element, reporting failure as a `Result`.
+  Result<output_type> checked(const input_type &in) const noexcept {
+    output_raw_type out{};
+    const char *operation = "";
+    const tempoch_status_t status = apply(to_raw(in), &out, &operation);
+    if (status != TEMPOCH_STATUS_T_OK)
+      return Error{status, operation};
+    return from_raw(out);
+  }
+
+  /// Convert a block; failed slots of @p out are left unmodified.
+  BatchStatus operator()(span<const input_type> in, span<output_type> out) const {
+    detail::ensure_same_length(in.size(), out.size(), "tempoch::ConversionPlan");
+    BatchStatus status(in.size());
+    const char *operation = "";
+    for (std::size_t i = 0; i < in.size(); ++i) {
+      output_raw_type raw{};
+      const tempoch_status_t s = apply(to_raw(in[i]), &raw, &operation);
+      if (s == TEMPOCH_STATUS_T_OK)
+        out[i] = from_raw(raw);
+      else
+        status.set(i, s);
+    }
+    return status;
+  }
+
+  /// Convert a raw value column; non-finite inputs fail and failed slots hold NaN.
+  template <bool Enabled = !from_time && !to_time, std::enable_if_t<Enabled, int> = 0>
+  BatchStatus operator()(span<const double> in, span<double> out) const {
+    detail::ensure_same_length(in.size(), out.size(), "tempoch::ConversionPlan");
+    BatchStatus status(in.size());
+    const char *operation = "";
+    for (std::size_t i = 0; i < in.size(); ++i) {
+      tempoch_status_t s = TEMPOCH_STATUS_T_CONVERSION_FAILED;
+      if (std::isfinite(in[i]))
+        s = apply(in[i], &out[i], &operation);
+      if (s != TEMPOCH_STATUS_T_OK) {
+        out[i] = std::numeric_limits<double>::quiet_NaN();
+        status.set(i, s);
+      }
+    }
+    return status;
+  }
+
+  /// Run the route on raw storage; @p operation names the failing step.
+  tempoch_status_t apply(const input_raw_type &in, output_raw_type *out,
+                         const char **operation) const noexcept {
+    if constexpr (direct_transcode) {
+      if constexpr (std::is_same_v<FromFormat, ToFormat>)
+        *out = in;
+      else
+        *out = detail::native_transcode<FromScale, FromFormat, ToFormat>(in);
+      return TEMPOCH_STATUS_T_OK;
+    } else {
+      tempoch_time_t split{};
+      tempoch_status_t status = TEMPOCH_STATUS_T_OK;
+      if constexpr (from_time) {
+        split = in;
+      } else {
+        status = detail::try_decode_time<FromScale, FromFormat>(in, raw_ctx_, &split);
+        if (status != TEMPOCH_STATUS_T_OK) {
+          *operation = "tempoch_time_from_format";
+          return status;
+        }
+      }
+
+      tempoch_time_t converted{};
+      status = detail::try_scale_convert<FromScale, ToScale>(split, raw_ctx_, &converted);
+      if (status != TEMPOCH_STATUS_T_OK) {
+        *operation = "tempoch_time_scale_convert";
+        return status;
+      }
+
+      if constexpr (to_time) {
+        *out = converted;
+      } else {
+        status = detail::try_encode_time<ToScale, ToFormat>(converted, raw_ctx_, out);
+        if (status == TEMPOCH_STATUS_T_OK && !std::isfinite(*out))
+          status = TEMPOCH_STATUS_T_CONVERSION_FAILED;
+        if (status != TEMPOCH_STATUS_T_OK)
+          *operation = "tempoch_time_to_format";
+      }
+      return status;
+    }
+  }
+
+private:
+  std::optional<TimeContext> ctx_;
+  const tempoch_context_t *raw_ctx_ = nullptr;
+
+  static input_raw_type to_raw(const input_type &in) noexcept {
+    if constexpr (from_time)
+      return in.c_inner();
+    else
+      return in.value();
+  }
+
+  static output_type from_raw(const output_raw_type &raw) noexcept {
+    if constexpr (to_time)
+      return Time<ToScale>::from_c(raw);
+    else
+      return output_type(raw);
+  }
+};
+
+} // namespace tempoch
@@ -11,8 +11,12 @@
  */
 
 #include "ffi_core.hpp"
+#include "leap_table.hpp"
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <optional>
 
 namespace tempoch {
@@ -62,7 +66,8 @@ struct TimeDataStatus {
 /// Mirrors `tempoch::time_data_status()`.
 inline TimeDataStatus time_data_status() {
   TempochDataHorizons raw{};
-  check_status(tempoch_time_data_status(&raw), "tempoch::time_data_status");
+  check_status(TEMPOCH_FFI_CALL(tempoch_time_data_status)(&raw), "tempoch::time_data_status");
+  detail::LeapTableRegistry::instance().observe(raw);
 
   auto opt = [](double v) -> std::optional<double> {
     return std::isnan(v) ? std::nullopt : std::optional<double>(v);
@@ -78,4 +83,41 @@ inline TimeDataStatus time_data_status() {
   return status;
 }
 
+namespace detail {
+
+/// FNV-1a over the horizons and source; NaN horizons hash as one canonical NaN.
+inline uint64_t fingerprint_of(const TempochDataHorizons &raw) noexcept {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  const auto mix = [&hash](uint64_t word) {
+    for (int i = 0; i < 8; ++i) {
+      hash ^= (word >> (8 * i)) & 0xFF;
+      hash *= 0x100000001b3ull;
+    }
+  };
+  for (double v : {raw.eop_start_mjd, raw.eop_observed_end_mjd, raw.eop_end_mjd,
+                   raw.modern_delta_t_observed_end_mjd, raw.delta_t_prediction_horizon_mjd}) {
+    if (std::isnan(v))
+      v = std::numeric_limits<double>::quiet_NaN();
+    uint64_t bits = 0;
+    std::memcpy(&bits, &v, sizeof bits);
+    mix(bits);
+  }
+  mix(static_cast<uint64_t>(raw.source));
+  return hash;
+}
+
+} // namespace detail
+
+/// 64-bit fingerprint of the active time-data bundle.
+///
+/// Equal for bundles with the same horizons and source.  Persisted data such
+/// as `write_time_series` files records it, so a reader can tell whether the
+/// bundle that produced the values is still the active one.
+inline uint64_t time_data_fingerprint() {
+  TempochDataHorizons raw{};
+  check_status(TEMPOCH_FFI_CALL(tempoch_time_data_status)(&raw), "tempoch::time_data_fingerprint");
+  detail::LeapTableRegistry::instance().observe(raw);
+  return detail::fingerprint_of(raw);
+}
+
 } // namespace tempoch
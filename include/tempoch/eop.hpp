@@ -63,7 +63,9 @@ struct EopValues {
  * @param mjd_utc UTC Modified Julian Date to query.
  * @return `true` if `eop_at(mjd_utc)` would succeed.
  */
-inline bool eop_covers(double mjd_utc) noexcept { return tempoch_eop_covers(mjd_utc); }
+inline bool eop_covers(double mjd_utc) noexcept {
+  return TEMPOCH_FFI_CALL(tempoch_eop_covers)(mjd_utc);
+}
 
 /**
  * @brief Interpolate IERS EOP values at `mjd_utc`.
@@ -80,7 +82,7 @@ inline bool eop_covers(double mjd_utc) noexcept { return tempoch_eop_covers(mjd_
  */
 inline std::optional<EopValues> eop_at(double mjd_utc) {
   tempoch_eop_values_t raw{};
-  tempoch_status_t status = tempoch_eop_at(mjd_utc, &raw);
+  tempoch_status_t status = TEMPOCH_FFI_CALL(tempoch_eop_at)(mjd_utc, &raw);
 
   if (status == TEMPOCH_STATUS_T_UT1_HORIZON_EXCEEDED)
     return std::nullopt;
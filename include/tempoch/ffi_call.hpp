@@ -0,0 +1,135 @@
+#pragma once
+
+/**
+ * @file ffi_call.hpp
+ * @brief `TEMPOCH_FFI_CALL`, the probe every tempoch-ffi call goes through.
+ *
+ * The expansion is the same whatever `TEMPOCH_FFI_STATS` is set to, so
+ * translation units built with different settings share one definition of
+ * every wrapper function.  The probe forwards straight to the C function
+ * until ffi_stats.hpp, included by a `TEMPOCH_FFI_STATS=1` translation unit,
+ * installs its timing hooks; from then on every call in the program is
+ * counted.  Until then a call costs one extra atomic load.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#ifndef TEMPOCH_FFI_STATS
+#define TEMPOCH_FFI_STATS 0
+#endif
+
+/// Entry points of tempoch-ffi called by the wrapper.
+#define TEMPOCH_FFI_ENTRY_POINTS(X)                                                                \
+  X(tempoch_const_delta_t_prediction_horizon_mjd)                                                  \
+  X(tempoch_const_eop_end_mjd)                                                                     \
+  X(tempoch_const_eop_observed_end_mjd)                                                            \
+  X(tempoch_const_eop_start_mjd)                                                                   \
+  X(tempoch_const_gps_epoch_jd_tai)                                                                \
+  X(tempoch_const_gps_epoch_jd_utc)                                                                \
+  X(tempoch_const_gps_epoch_tai_minus_utc_seconds)                                                 \
+  X(tempoch_const_iau_time_epoch_t0_jd)                                                            \
+  X(tempoch_const_j2000_jd_tt)                                                                     \
+  X(tempoch_const_julian_year_days)                                                                \
+  X(tempoch_const_modern_delta_t_observed_end_mjd)                                                 \
+  X(tempoch_const_nanos_per_second)                                                                \
+  X(tempoch_const_tdb_tt_model_high_accuracy_end_jd)                                               \
+  X(tempoch_const_tdb_tt_model_high_accuracy_start_jd)                                             \
+  X(tempoch_const_tt_minus_tai_seconds)                                                            \
+  X(tempoch_const_unix_epoch_jd)                                                                   \
+  X(tempoch_const_unix_epoch_mjd)                                                                  \
+  X(tempoch_const_utc_defined_from_mjd)                                                            \
+  X(tempoch_context_allow_pre_definition_utc)                                                      \
+  X(tempoch_context_create_default)                                                                \
+  X(tempoch_context_create_with_builtin_eop)                                                       \
+  X(tempoch_context_free)                                                                          \
+  X(tempoch_delta_t_seconds)                                                                       \
+  X(tempoch_delta_t_seconds_extrapolated)                                                          \
+  X(tempoch_eop_at)                                                                                \
+  X(tempoch_eop_covers)                                                                            \
+  X(tempoch_period_list_complement)                                                                \
+  X(tempoch_period_list_intersect)                                                                 \
+  X(tempoch_period_list_normalize)                                                                 \
+  X(tempoch_period_list_union)                                                                     \
+  X(tempoch_period_list_validate)                                                                  \
+  X(tempoch_period_mjd_free)                                                                       \
+  X(tempoch_time_add_seconds)                                                                      \
+  X(tempoch_time_data_status)                                                                      \
+  X(tempoch_time_difference_seconds)                                                               \
+  X(tempoch_time_from_civil)                                                                       \
+  X(tempoch_time_from_format)                                                                      \
+  X(tempoch_time_from_gnss_week)                                                                   \
+  X(tempoch_time_scale_convert)                                                                    \
+  X(tempoch_time_to_civil)                                                                         \
+  X(tempoch_time_to_format)                                                                        \
+  X(tempoch_time_to_gnss_week)
+
+namespace tempoch {
+
+/// One enumerator per `TEMPOCH_FFI_ENTRY_POINTS` name.
+enum class FfiEntry : std::uint16_t {
+#define TEMPOCH_FFI_ENTRY_ENUM(name) name,
+  TEMPOCH_FFI_ENTRY_POINTS(TEMPOCH_FFI_ENTRY_ENUM)
+#undef TEMPOCH_FFI_ENTRY_ENUM
+};
+
+inline constexpr std::size_t kFfiEntryCount = 0
+#define TEMPOCH_FFI_ENTRY_COUNT(name) +1
+    TEMPOCH_FFI_ENTRY_POINTS(TEMPOCH_FFI_ENTRY_COUNT)
+#undef TEMPOCH_FFI_ENTRY_COUNT
+    ;
+
+namespace detail {
+
+/// Timing hooks installed by ffi_stats.hpp.
+struct FfiStatsHooks {
+  std::uint64_t (*now_nanoseconds)() noexcept;
+  void (*record)(FfiEntry entry, std::uint64_t nanoseconds) noexcept;
+};
+
+/// Process-wide hook slot; null while no translation unit enables the counters.
+inline std::atomic<const FfiStatsHooks *> &ffi_stats_hooks() noexcept {
+  static std::atomic<const FfiStatsHooks *> hooks{nullptr};
+  return hooks;
+}
+
+/// Times the enclosing call and charges it to @p E on scope exit.
+template <FfiEntry E> class FfiCallScope {
+public:
+  explicit FfiCallScope(const FfiStatsHooks *hooks) noexcept
+      : hooks_(hooks), start_(hooks->now_nanoseconds()) {}
+  ~FfiCallScope() { hooks_->record(E, hooks_->now_nanoseconds() - start_); }
+  FfiCallScope(const FfiCallScope &) = delete;
+  FfiCallScope &operator=(const FfiCallScope &) = delete;
+
+private:
+  const FfiStatsHooks *hooks_;
+  std::uint64_t start_;
+};
+
+/// Callable standing in for an FFI function.
+template <FfiEntry E, typename Fn> struct FfiProbe {
+  Fn *fn;
+
+  template <typename... Args> decltype(auto) operator()(Args &&...args) const {
+    const FfiStatsHooks *hooks = ffi_stats_hooks().load(std::memory_order_acquire);
+    if (hooks == nullptr)
+      return fn(std::forward<Args>(args)...);
+    FfiCallScope<E> scope(hooks);
+    return fn(std::forward<Args>(args)...);
+  }
+};
+
+} // namespace detail
+} // namespace tempoch
+
+/**
+ * @brief Call tempoch-ffi entry point @p fn, counting it once the counters are enabled.
+ *
+ * Usage: `TEMPOCH_FFI_CALL(tempoch_time_scale_convert)(value, from, to, ctx, &out)`.
+ * @p fn must be listed in `TEMPOCH_FFI_ENTRY_POINTS`.
+ */
+#define TEMPOCH_FFI_CALL(fn)                                                                       \
+  (::tempoch::detail::FfiProbe<::tempoch::FfiEntry::fn, decltype(fn)>{&fn})
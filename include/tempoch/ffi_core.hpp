@@ -8,6 +8,11 @@
  * hierarchy, and provides a check_status helper.
  */
 
+#include "ffi_call.hpp"
+#if TEMPOCH_FFI_STATS
+#include "ffi_stats.hpp"
+#endif
+
 #include <stdexcept>
 #include <string>
 
@@ -133,6 +138,42 @@ public:
 // Error Translation
 // ============================================================================
 
+/**
+ * @brief Static description of a tempoch_status_t (no allocation).
+ */
+inline const char *status_message(tempoch_status_t status) noexcept {
+  switch (status) {
+  case TEMPOCH_STATUS_T_OK:
+    return "ok";
+  case TEMPOCH_STATUS_T_NULL_POINTER:
+    return "null output pointer";
+  case TEMPOCH_STATUS_T_UTC_CONVERSION_FAILED:
+    return "UTC conversion failed";
+  case TEMPOCH_STATUS_T_INVALID_PERIOD:
+    return "invalid period (start > end)";
+  case TEMPOCH_STATUS_T_NO_INTERSECTION:
+    return "periods do not intersect";
+  case TEMPOCH_STATUS_T_INVALID_SCALE_ID:
+    return "invalid scale id";
+  case TEMPOCH_STATUS_T_INVALID_DURATION_UNIT:
+    return "invalid duration unit";
+  case TEMPOCH_STATUS_T_CONVERSION_FAILED:
+    return "conversion failed";
+  case TEMPOCH_STATUS_T_INVALID_FORMAT_ID:
+    return "invalid format id";
+  case TEMPOCH_STATUS_T_INTERNAL_PANIC:
+    return "internal panic";
+  case TEMPOCH_STATUS_T_UT1_HORIZON_EXCEEDED:
+    return "UT1 horizon exceeded";
+  case TEMPOCH_STATUS_T_PERIOD_LIST_UNSORTED:
+    return "period list is not sorted";
+  case TEMPOCH_STATUS_T_PERIOD_LIST_OVERLAPPING:
+    return "period list has overlapping intervals";
+  default:
+    return "unknown error";
+  }
+}
+
 /**
  * @brief Check a tempoch_status_t and throw the appropriate exception on error.
  */
@@ -140,34 +181,34 @@ inline void check_status(tempoch_status_t status, const char *operation) {
   if (status == TEMPOCH_STATUS_T_OK)
     return;
 
-  std::string msg = std::string(operation) + " failed: ";
+  std::string msg = std::string(operation) + " failed: " + status_message(status);
   switch (status) {
   case TEMPOCH_STATUS_T_NULL_POINTER:
-    throw NullPointerError(msg + "null output pointer");
+    throw NullPointerError(msg);
   case TEMPOCH_STATUS_T_UTC_CONVERSION_FAILED:
-    throw UtcConversionError(msg + "UTC conversion failed");
+    throw UtcConversionError(msg);
   case TEMPOCH_STATUS_T_INVALID_PERIOD:
-    throw InvalidPeriodError(msg + "invalid period (start > end)");
+    throw InvalidPeriodError(msg);
   case TEMPOCH_STATUS_T_NO_INTERSECTION:
-    throw NoIntersectionError(msg + "periods do not intersect");
+    throw NoIntersectionError(msg);
   case TEMPOCH_STATUS_T_INVALID_SCALE_ID:
-    throw InvalidScaleIdError(msg + "invalid scale id");
+    throw InvalidScaleIdError(msg);
   case TEMPOCH_STATUS_T_INVALID_DURATION_UNIT:
-    throw InvalidDurationUnitError(msg + "invalid duration unit");
+    throw InvalidDurationUnitError(msg);
   case TEMPOCH_STATUS_T_CONVERSION_FAILED:
-    throw ConversionFailedError(msg + "conversion failed");
+    throw ConversionFailedError(msg);
   case TEMPOCH_STATUS_T_INVALID_FORMAT_ID:
-    throw InvalidFormatIdError(msg + "invalid format id");
+    throw InvalidFormatIdError(msg);
   case TEMPOCH_STATUS_T_INTERNAL_PANIC:
-    throw InternalPanicError(msg + "internal panic");
+    throw InternalPanicError(msg);
   case TEMPOCH_STATUS_T_UT1_HORIZON_EXCEEDED:
-    throw Ut1HorizonExceededError(msg + "UT1 horizon exceeded");
+    throw Ut1HorizonExceededError(msg);
   case TEMPOCH_STATUS_T_PERIOD_LIST_UNSORTED:
-    throw PeriodListUnsortedError(msg + "period list is not sorted");
+    throw PeriodListUnsortedError(msg);
   case TEMPOCH_STATUS_T_PERIOD_LIST_OVERLAPPING:
-    throw PeriodListOverlappingError(msg + "period list has overlapping intervals");
+    throw PeriodListOverlappingError(msg);
   default:
-    throw TempochException(msg + "unknown error (" + std::to_string(status) + ")");
+    throw TempochException(msg + " (" + std::to_string(status) + ")");
   }
 }
 
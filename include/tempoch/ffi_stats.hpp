@@ -0,0 +1,243 @@
+#pragma once
+
+/**
+ * @file ffi_stats.hpp
+ * @brief Opt-in call counters for the tempoch-ffi boundary.
+ *
+ * Every call the wrapper makes into tempoch-ffi goes through
+ * `TEMPOCH_FFI_CALL(fn)(args...)` (ffi_call.hpp).  Building a translation unit
+ * with `-DTEMPOCH_FFI_STATS=1` (CMake: `TEMPOCH_ENABLE_FFI_STATS=ON`) makes it
+ * include this header from ffi_core.hpp and install the timing hooks, after
+ * which each call bumps a per-thread call count and accumulated steady-clock
+ * nanoseconds for its entry point.  With the flag undefined or 0 (the
+ * default) this header is not pulled in and the counters stay at zero.
+ *
+ * @code
+ * tempoch::reset_ffi_stats_thread();
+ * auto jd = unix_time.to<tempoch::scale::TT, tempoch::format::JD>();
+ * std::cout << tempoch::ffi_stats_thread();   // one line per entry point called
+ * @endcode
+ *
+ * Nothing here depends on the flag except the hook installation, so mixing
+ * settings across translation units is safe: the counters are on for the
+ * whole program as soon as one translation unit enables them.
+ */
+
+#include "ffi_call.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace tempoch {
+
+/// Whether this translation unit was built with `TEMPOCH_FFI_STATS=1` (internal linkage).
+constexpr bool kFfiStatsEnabled = TEMPOCH_FFI_STATS != 0;
+
+/// C symbol name of @p entry.
+inline const char *ffi_entry_name(FfiEntry entry) noexcept {
+  static constexpr const char *names[] = {
+#define TEMPOCH_FFI_ENTRY_NAME(name) #name,
+      TEMPOCH_FFI_ENTRY_POINTS(TEMPOCH_FFI_ENTRY_NAME)
+#undef TEMPOCH_FFI_ENTRY_NAME
+  };
+  const auto index = static_cast<std::size_t>(entry);
+  return index < kFfiEntryCount ? names[index] : "unknown";
+}
+
+/// Calls made to one entry point and the wall time spent inside them.
+struct FfiCounter {
+  std::uint64_t calls = 0;
+  std::uint64_t nanoseconds = 0;
+};
+
+/// Point-in-time copy of the counters, indexed by `FfiEntry`.
+struct FfiStats {
+  std::array<FfiCounter, kFfiEntryCount> entries{};
+
+  const FfiCounter &operator[](FfiEntry entry) const noexcept {
+    return entries[static_cast<std::size_t>(entry)];
+  }
+  FfiCounter &operator[](FfiEntry entry) noexcept {
+    return entries[static_cast<std::size_t>(entry)];
+  }
+
+  std::uint64_t total_calls() const noexcept {
+    std::uint64_t total = 0;
+    for (const auto &e : entries)
+      total += e.calls;
+    return total;
+  }
+
+  std::uint64_t total_nanoseconds() const noexcept {
+    std::uint64_t total = 0;
+    for (const auto &e : entries)
+      total += e.nanoseconds;
+    return total;
+  }
+
+  /// Counters accumulated since @p earlier (a previous snapshot of the same source).
+  FfiStats operator-(const FfiStats &earlier) const noexcept {
+    FfiStats out;
+    for (std::size_t i = 0; i < kFfiEntryCount; ++i) {
+      out.entries[i].calls = entries[i].calls - earlier.entries[i].calls;
+      out.entries[i].nanoseconds = entries[i].nanoseconds - earlier.entries[i].nanoseconds;
+    }
+    return out;
+  }
+};
+
+/// Print one `name: calls, ns` line per entry point that was called.
+inline std::ostream &operator<<(std::ostream &os, const FfiStats &stats) {
+  for (std::size_t i = 0; i < kFfiEntryCount; ++i) {
+    const FfiCounter &c = stats.entries[i];
+    if (c.calls != 0)
+      os << ffi_entry_name(static_cast<FfiEntry>(i)) << ": " << c.calls << " calls, "
+         << c.nanoseconds << " ns\n";
+  }
+  return os;
+}
+
+namespace detail {
+
+/// Counters owned by one thread.  Only the owner writes; snapshots read them
+/// concurrently, hence the relaxed atomics (a load + store, never an RMW).
+struct FfiThreadCounters {
+  std::array<std::atomic<std::uint64_t>, kFfiEntryCount> calls{};
+  std::array<std::atomic<std::uint64_t>, kFfiEntryCount> nanoseconds{};
+
+  void record(FfiEntry entry, std::uint64_t ns) noexcept {
+    const auto i = static_cast<std::size_t>(entry);
+    calls[i].store(calls[i].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    nanoseconds[i].store(nanoseconds[i].load(std::memory_order_relaxed) + ns,
+                         std::memory_order_relaxed);
+  }
+
+  void add_to(FfiStats &out) const noexcept {
+    for (std::size_t i = 0; i < kFfiEntryCount; ++i) {
+      out.entries[i].calls += calls[i].load(std::memory_order_relaxed);
+      out.entries[i].nanoseconds += nanoseconds[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  void clear() noexcept {
+    for (std::size_t i = 0; i < kFfiEntryCount; ++i) {
+      calls[i].store(0, std::memory_order_relaxed);
+      nanoseconds[i].store(0, std::memory_order_relaxed);
+    }
+  }
+};
+
+/// Live per-thread counters plus the totals of threads that have exited.
+class FfiStatsRegistry {
+public:
+  static FfiStatsRegistry &instance() {
+    // Leaked so thread-exit hooks running during shutdown can still reach it.
+    static FfiStatsRegistry *registry = new FfiStatsRegistry();
+    return *registry;
+  }
+
+  void attach(FfiThreadCounters *counters) noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    try {
+      live_.push_back(counters);
+    } catch (...) {
+      // Out of memory: the thread still counts locally, it is just missing from ffi_stats().
+    }
+  }
+
+  void detach(FfiThreadCounters *counters) noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (std::size_t i = 0; i < live_.size(); ++i) {
+      if (live_[i] == counters) {
+        counters->add_to(retired_);
+        live_[i] = live_.back();
+        live_.pop_back();
+        return;
+      }
+    }
+  }
+
+  FfiStats snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    FfiStats out = retired_;
+    for (const FfiThreadCounters *counters : live_)
+      counters->add_to(out);
+    return out;
+  }
+
+  void reset() noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    retired_ = FfiStats{};
+    for (FfiThreadCounters *counters : live_)
+      counters->clear();
+  }
+
+private:
+  FfiStatsRegistry() = default;
+
+  mutable std::mutex mutex_;
+  std::vector<FfiThreadCounters *> live_;
+  FfiStats retired_;
+};
+
+struct FfiThreadSlot {
+  FfiThreadCounters counters;
+  FfiThreadSlot() noexcept { FfiStatsRegistry::instance().attach(&counters); }
+  ~FfiThreadSlot() { FfiStatsRegistry::instance().detach(&counters); }
+  FfiThreadSlot(const FfiThreadSlot &) = delete;
+  FfiThreadSlot &operator=(const FfiThreadSlot &) = delete;
+};
+
+inline FfiThreadCounters &ffi_thread_counters() noexcept {
+  thread_local FfiThreadSlot slot;
+  return slot.counters;
+}
+
+inline std::uint64_t ffi_stats_now_nanoseconds() noexcept {
+  const auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+inline void ffi_stats_record(FfiEntry entry, std::uint64_t nanoseconds) noexcept {
+  ffi_thread_counters().record(entry, nanoseconds);
+}
+
+/// Start counting every `TEMPOCH_FFI_CALL` in the program.
+inline bool install_ffi_stats_hooks() noexcept {
+  static constexpr FfiStatsHooks hooks{&ffi_stats_now_nanoseconds, &ffi_stats_record};
+  ffi_stats_hooks().store(&hooks, std::memory_order_release);
+  return true;
+}
+
+#if TEMPOCH_FFI_STATS
+namespace {
+[[maybe_unused]] const bool ffi_stats_hooks_installed = install_ffi_stats_hooks();
+} // namespace
+#endif
+
+} // namespace detail
+
+/// Counters of the calling thread.  All zero unless a translation unit enabled them.
+inline FfiStats ffi_stats_thread() noexcept {
+  FfiStats out;
+  detail::ffi_thread_counters().add_to(out);
+  return out;
+}
+
+/// Counters summed over every thread, including threads that have exited.
+inline FfiStats ffi_stats() { return detail::FfiStatsRegistry::instance().snapshot(); }
+
+/// Zero the calling thread's counters.
+inline void reset_ffi_stats_thread() noexcept { detail::ffi_thread_counters().clear(); }
+
+/// Zero every thread's counters.  Calls racing with the reset may survive it.
+inline void reset_ffi_stats() noexcept { detail::FfiStatsRegistry::instance().reset(); }
+
+} // namespace tempoch
@@ -45,9 +45,9 @@ struct GnssWeek {
 template <typename S, std::enable_if_t<is_gnss_scale_v<S>, int> = 0>
 inline GnssWeek to_gnss_week(const Time<S> &time) {
   TempochGnssWeek raw{};
-  check_status(
-      tempoch_time_to_gnss_week(time.c_inner(), static_cast<int32_t>(scale_tag_v<S>), &raw),
-      "tempoch::to_gnss_week");
+  check_status(TEMPOCH_FFI_CALL(tempoch_time_to_gnss_week)(
+                   time.c_inner(), static_cast<int32_t>(scale_tag_v<S>), &raw),
+               "tempoch::to_gnss_week");
   return GnssWeek{raw.week, raw.seconds_of_week, raw.subsecond_nanos};
 }
 
@@ -56,9 +56,36 @@ template <typename S, std::enable_if_t<is_gnss_scale_v<S>, int> = 0>
 inline Time<S> from_gnss_week(const GnssWeek &gw) {
   TempochGnssWeek raw{gw.week, gw.seconds_of_week, gw.subsecond_nanos};
   tempoch_time_t out{};
-  check_status(tempoch_time_from_gnss_week(raw, static_cast<int32_t>(scale_tag_v<S>), &out),
+  check_status(TEMPOCH_FFI_CALL(tempoch_time_from_gnss_week)(
+                   raw, static_cast<int32_t>(scale_tag_v<S>), &out),
                "tempoch::from_gnss_week");
   return Time<S>::from_split_seconds(qtty::Second(out.hi_seconds), qtty::Second(out.lo_seconds));
 }
 
+/// Non-throwing `to_gnss_week`.
+template <typename S, std::enable_if_t<is_gnss_scale_v<S>, int> = 0>
+inline Result<GnssWeek> checked_to_gnss_week(const Time<S> &time) noexcept {
+  TempochGnssWeek raw{};
+  const tempoch_status_t status =
+      TEMPOCH_FFI_CALL(tempoch_time_to_gnss_week)(time.c_inner(),
+                                                  static_cast<int32_t>(scale_tag_v<S>), &raw);
+  if (status != TEMPOCH_STATUS_T_OK)
+    return Error{status, "tempoch::to_gnss_week"};
+  return GnssWeek{raw.week, raw.seconds_of_week, raw.subsecond_nanos};
+}
+
+/// Non-throwing `from_gnss_week`.
+template <typename S, std::enable_if_t<is_gnss_scale_v<S>, int> = 0>
+inline Result<Time<S>> checked_from_gnss_week(const GnssWeek &gw) noexcept {
+  TempochGnssWeek raw{gw.week, gw.seconds_of_week, gw.subsecond_nanos};
+  tempoch_time_t out{};
+  const tempoch_status_t status =
+      TEMPOCH_FFI_CALL(tempoch_time_from_gnss_week)(raw, static_cast<int32_t>(scale_tag_v<S>),
+                                                    &out);
+  if (status != TEMPOCH_STATUS_T_OK)
+    return Error{status, "tempoch::from_gnss_week"};
+  return Time<S>::checked_from_split_seconds(qtty::Second(out.hi_seconds),
+                                             qtty::Second(out.lo_seconds));
+}
+
 } // namespace tempoch
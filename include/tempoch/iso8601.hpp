@@ -0,0 +1,353 @@
+#pragma once
+
+/**
+ * @file iso8601.hpp
+ * @brief Allocation-free ISO 8601 / RFC 3339 timestamp parsing.
+ *
+ * `parse_iso8601` reads the extended date-time form
+ *
+ *     YYYY-MM-DD('T'|'t'|' ')hh:mm:ss[('.'|',')f...][Z | z | ±hh[[:]mm]]
+ *
+ * into a UTC `CivilTime`.  Fractions are kept to the nanosecond; further
+ * digits are validated and truncated.  A numeric offset is removed, so the
+ * result is always the UTC label, and a timestamp without a designator is
+ * taken to be UTC already.  Leap-second labels (`ss == 60`) are accepted
+ * when they fall on the last minute of a UTC day; whether that day really
+ * ends in a leap second is checked only when the label is turned into a
+ * `Time<UTC>` (`parse_iso8601_utc`, `Time<UTC>::from_civil`).
+ *
+ * @code
+ * auto civil = tempoch::parse_iso8601("2016-12-31T23:59:60.25Z");
+ * auto utc = tempoch::parse_iso8601_utc("2026-07-16T00:00:00+02:00");   // 2026-07-15 22:00 UTC
+ * if (!utc)
+ *   std::cerr << utc.error().operation << ": " << utc.error().message() << '\n';
+ * @endcode
+ *
+ * Malformed text is reported as `TEMPOCH_STATUS_T_CONVERSION_FAILED`; no
+ * exception is built and nothing is allocated.  `parse_iso8601_fixed`
+ * parses a block of fixed-width records (e.g. log lines) and validates the
+ * `YYYY-MM-DDThh:mm:ss` head of each one eight bytes at a time.
+ */
+
+#include "batch.hpp"
+#include "civil_time.hpp"
+#include "result.hpp"
+#include "span.hpp"
+#include "time_base.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace tempoch {
+
+namespace detail {
+
+inline constexpr std::size_t kIso8601HeadLength = 19; // YYYY-MM-DDThh:mm:ss
+
+inline constexpr bool is_ascii_digit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+/// Read exactly @p n digits at @p p into @p out; false if any is not a digit.
+inline bool parse_fixed_digits(const char *p, int n, uint32_t *out) noexcept {
+  uint32_t value = 0;
+  for (int i = 0; i < n; ++i) {
+    if (!is_ascii_digit(p[i]))
+      return false;
+    value = value * 10 + static_cast<uint32_t>(p[i] - '0');
+  }
+  *out = value;
+  return true;
+}
+
+inline constexpr bool is_gregorian_leap_year(int64_t y) noexcept {
+  return y % 4 == 0 && (y % 100 != 0 || y % 400 == 0);
+}
+
+inline constexpr unsigned days_in_month(int64_t y, unsigned m) noexcept {
+  constexpr unsigned kDays[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  return m == 2 && is_gregorian_leap_year(y) ? 29 : kDays[m - 1];
+}
+
+/// Days since 1970-01-01 of a proleptic Gregorian date (H. Hinnant's `days_from_civil`).
+inline constexpr int64_t days_from_civil(int64_t y, unsigned m, unsigned d) noexcept {
+  y -= m <= 2;
+  const int64_t era = (y >= 0 ? y : y - 399) / 400;
+  const auto yoe = static_cast<unsigned>(y - era * 400);
+  const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146'097 + static_cast<int64_t>(doe) - 719'468;
+}
+
+/// Inverse of `days_from_civil`; writes the date into @p c.
+inline void civil_from_days(int64_t z, CivilTime *c) noexcept {
+  z += 719'468;
+  const int64_t era = (z >= 0 ? z : z - 146'096) / 146'097;
+  const auto doe = static_cast<unsigned>(z - era * 146'097);
+  const unsigned yoe = (doe - doe / 1'460 + doe / 36'524 - doe / 146'096) / 365;
+  const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const unsigned mp = (5 * doy + 2) / 153;
+  const unsigned m = mp < 10 ? mp + 3 : mp - 9;
+  c->year = static_cast<int32_t>(static_cast<int64_t>(yoe) + era * 400 + (m <= 2));
+  c->month = static_cast<uint8_t>(m);
+  c->day = static_cast<uint8_t>(doy - (153 * mp + 2) / 5 + 1);
+}
+
+/// Scalar head parser; accepts `T`, `t` or a space between date and time.
+inline bool parse_iso8601_head(const char *p, CivilTime *c) noexcept {
+  uint32_t year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+  if (!parse_fixed_digits(p, 4, &year) || p[4] != '-' || !parse_fixed_digits(p + 5, 2, &month) ||
+      p[7] != '-' || !parse_fixed_digits(p + 8, 2, &day))
+    return false;
+  if (p[10] != 'T' && p[10] != 't' && p[10] != ' ')
+    return false;
+  if (!parse_fixed_digits(p + 11, 2, &hour) || p[13] != ':' ||
+      !parse_fixed_digits(p + 14, 2, &minute) || p[16] != ':' ||
+      !parse_fixed_digits(p + 17, 2, &second))
+    return false;
+  *c = CivilTime(static_cast<int32_t>(year), static_cast<uint8_t>(month),
+                 static_cast<uint8_t>(day), static_cast<uint8_t>(hour),
+                 static_cast<uint8_t>(minute), static_cast<uint8_t>(second));
+  return true;
+}
+
+// -- SWAR head parser -----------------------------------------------------------
+//
+// The fixed head is checked as three overlapping 8-byte words.  Digit bytes
+// must have high nibble 3 and must keep it after adding 6 (so the low nibble
+// is at most 9); every other byte must equal its literal.
+
+struct SwarPattern {
+  uint64_t digits = 0;       ///< 0xFF in every digit byte.
+  uint64_t literal_mask = 0; ///< 0xFF in every literal byte.
+  uint64_t literal = 0;      ///< Expected value of the literal bytes.
+};
+
+/// Masks for an 8-character pattern in which `D` stands for any decimal digit.
+constexpr SwarPattern swar_pattern(const char (&pattern)[9]) noexcept {
+  SwarPattern out;
+  for (int i = 0; i < 8; ++i) {
+    const uint64_t byte = uint64_t{0xFF} << (8 * i);
+    if (pattern[i] == 'D') {
+      out.digits |= byte;
+    } else {
+      out.literal_mask |= byte;
+      out.literal |= uint64_t{static_cast<unsigned char>(pattern[i])} << (8 * i);
+    }
+  }
+  return out;
+}
+
+/// Little-endian load of 8 bytes, independent of the host byte order.
+inline uint64_t load_le64(const char *p) noexcept {
+  uint64_t w;
+  std::memcpy(&w, p, sizeof w);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  w = __builtin_bswap64(w);
+#endif
+  return w;
+}
+
+inline bool swar_match(uint64_t w, const SwarPattern &p) noexcept {
+  constexpr uint64_t kHighNibbles = 0xF0F0F0F0F0F0F0F0ull;
+  constexpr uint64_t kThrees = 0x3030303030303030ull;
+  constexpr uint64_t kSixes = 0x0606060606060606ull;
+  const uint64_t high = kHighNibbles & p.digits;
+  const uint64_t zeros = kThrees & p.digits;
+  return ((w & high) == zeros) && (((w + (kSixes & p.digits)) & high) == zeros) &&
+         ((w & p.literal_mask) == p.literal);
+}
+
+/// Value of eight ASCII digits already checked with `swar_match`, first digit most significant.
+inline uint32_t swar_eight_digits(uint64_t w) noexcept {
+  w &= 0x0F0F0F0F0F0F0F0Full;
+  w = (w * 10 + (w >> 8)) & 0x00FF00FF00FF00FFull;
+  w = (w * 100 + (w >> 16)) & 0x0000FFFF0000FFFFull;
+  return static_cast<uint32_t>((w * 10'000 + (w >> 32)) & 0xFFFFFFFFull);
+}
+
+/// SWAR head parser for the canonical `YYYY-MM-DDThh:mm:ss`; false sends the
+/// record to `parse_iso8601_head`.
+inline bool parse_iso8601_head_swar(const char *p, CivilTime *c) noexcept {
+  static constexpr SwarPattern kDate = swar_pattern("DDDD-DD-");
+  static constexpr SwarPattern kDayHourMinute = swar_pattern("DDTDD:DD");
+  static constexpr SwarPattern kClock = swar_pattern("DD:DD:DD");
+  const uint64_t date = load_le64(p);
+  const uint64_t day_hour_minute = load_le64(p + 8);
+  const uint64_t clock = load_le64(p + 11);
+  if (!swar_match(date, kDate) || !swar_match(day_hour_minute, kDayHourMinute) ||
+      !swar_match(clock, kClock))
+    return false;
+  const auto digit = [](uint64_t w, int i) { return static_cast<unsigned>((w >> (8 * i)) & 0xF); };
+  const auto pair = [&digit](uint64_t w, int i) {
+    return static_cast<uint8_t>(digit(w, i) * 10 + digit(w, i + 1));
+  };
+  *c = CivilTime(static_cast<int32_t>(pair(date, 0) * 100 + pair(date, 2)), pair(date, 5),
+                 pair(day_hour_minute, 0), pair(day_hour_minute, 3), pair(day_hour_minute, 6),
+                 pair(clock, 6));
+  return true;
+}
+
+/// Parse the fraction and zone designator after the head, validate, and shift to UTC.
+inline tempoch_status_t parse_iso8601_tail(const char *p, const char *end, CivilTime *c) noexcept {
+  constexpr tempoch_status_t kMalformed = TEMPOCH_STATUS_T_CONVERSION_FAILED;
+  constexpr uint32_t kScale[10] = {1'000'000'000, 100'000'000, 10'000'000, 1'000'000, 100'000,
+                                   10'000,        1'000,       100,        10,        1};
+
+  if (p != end && (*p == '.' || *p == ',')) {
+    ++p;
+    static constexpr SwarPattern kEightDigits = swar_pattern("DDDDDDDD");
+    uint32_t nanos = 0;
+    int digits = 0;
+    if (end - p >= 8 && swar_match(load_le64(p), kEightDigits)) {
+      nanos = swar_eight_digits(load_le64(p));
+      digits = 8;
+      p += 8;
+    }
+    for (; p != end && is_ascii_digit(*p); ++p, ++digits)
+      if (digits < 9)
+        nanos = nanos * 10 + static_cast<uint32_t>(*p - '0');
+    if (digits == 0)
+      return kMalformed;
+    c->nanosecond = nanos * kScale[digits < 9 ? digits : 9];
+  }
+
+  int offset_minutes = 0;
+  if (p != end) {
+    if (*p == 'Z' || *p == 'z') {
+      ++p;
+    } else if (*p == '+' || *p == '-') {
+      const int sign = *p == '-' ? -1 : 1;
+      uint32_t hours = 0, minutes = 0;
+      if (end - p < 3 || !parse_fixed_digits(p + 1, 2, &hours))
+        return kMalformed;
+      p += 3;
+      // `±hh`, `±hhmm` or `±hh:mm`; a colon must be followed by the minutes.
+      const bool colon = p != end && *p == ':';
+      if (colon)
+        ++p;
+      if (colon || p != end) {
+        if (end - p < 2 || !parse_fixed_digits(p, 2, &minutes))
+          return kMalformed;
+        p += 2;
+      }
+      if (hours > 23 || minutes > 59)
+        return kMalformed;
+      offset_minutes = sign * static_cast<int>(hours * 60 + minutes);
+    } else {
+      return kMalformed;
+    }
+  }
+  if (p != end)
+    return kMalformed;
+
+  if (c->month < 1 || c->month > 12 || c->day < 1 || c->day > days_in_month(c->year, c->month) ||
+      c->hour > 23 || c->minute > 59 || c->second > 60)
+    return kMalformed;
+
+  if (offset_minutes != 0) {
+    const int64_t minute_of_day = c->hour * 60 + c->minute - offset_minutes;
+    const int64_t day_shift = minute_of_day >= 0 ? minute_of_day / 1'440
+                                                 : -((1'439 - minute_of_day) / 1'440);
+    const int64_t utc_minute = minute_of_day - day_shift * 1'440;
+    if (day_shift != 0)
+      civil_from_days(days_from_civil(c->year, c->month, c->day) + day_shift, c);
+    c->hour = static_cast<uint8_t>(utc_minute / 60);
+    c->minute = static_cast<uint8_t>(utc_minute % 60);
+  }
+  // UTC inserts leap seconds only after 23:59:59.
+  if (c->second == 60 && (c->hour != 23 || c->minute != 59))
+    return kMalformed;
+  return TEMPOCH_STATUS_T_OK;
+}
+
+inline tempoch_status_t parse_iso8601_into(std::string_view text, CivilTime *out) noexcept {
+  CivilTime c;
+  if (text.size() < kIso8601HeadLength || !parse_iso8601_head(text.data(), &c))
+    return TEMPOCH_STATUS_T_CONVERSION_FAILED;
+  const tempoch_status_t status =
+      parse_iso8601_tail(text.data() + kIso8601HeadLength, text.data() + text.size(), &c);
+  if (status == TEMPOCH_STATUS_T_OK)
+    *out = c;
+  return status;
+}
+
+} // namespace detail
+
+/**
+ * @brief Parse an ISO 8601 / RFC 3339 timestamp into its UTC civil label.
+ *
+ * Numeric offsets are applied, so `2026-07-16T00:30:00+02:00` yields
+ * 2026-07-15 22:30:00.  Fails with `CONVERSION_FAILED` on malformed text or
+ * out-of-range fields (including Feb 29 of a common year).
+ */
+inline Result<CivilTime> parse_iso8601(std::string_view text) noexcept {
+  CivilTime out;
+  const tempoch_status_t status = detail::parse_iso8601_into(text, &out);
+  if (status != TEMPOCH_STATUS_T_OK)
+    return Error{status, "parse_iso8601"};
+  return out;
+}
+
+/// Parse a timestamp straight to `Time<UTC>`; also fails on labels UTC does not contain.
+inline Result<Time<scale::UTC>> parse_iso8601_utc(std::string_view text) noexcept {
+  CivilTime civil;
+  tempoch_status_t status = detail::parse_iso8601_into(text, &civil);
+  if (status != TEMPOCH_STATUS_T_OK)
+    return Error{status, "parse_iso8601_utc"};
+  tempoch_time_t raw{};
+  status = detail::try_time_from_civil(civil, nullptr, &raw);
+  if (status != TEMPOCH_STATUS_T_OK)
+    return Error{status, "parse_iso8601_utc"};
+  return Time<scale::UTC>::from_c(raw);
+}
+
+/**
+ * @brief Parse a block of timestamps into @p out.
+ *
+ * Failed slots of @p out are left unmodified and reported in the returned
+ * status.  Feed the result to the span overload of `from_civil` to obtain
+ * `Time<UTC>` values with one tempoch-ffi call per UTC day.
+ */
+inline BatchStatus parse_iso8601(span<const std::string_view> text, span<CivilTime> out) {
+  detail::ensure_same_length(text.size(), out.size(), "tempoch::parse_iso8601");
+  BatchStatus status(text.size());
+  for (std::size_t i = 0; i < text.size(); ++i)
+    status.set(i, detail::parse_iso8601_into(text[i], &out[i]));
+  return status;
+}
+
+/**
+ * @brief Parse fixed-width records: record `i` is `buffer[i * stride, (i + 1) * stride)`.
+ *
+ * Trailing `'\n'`, `'\r'` and spaces of each record are ignored, so a block
+ * of equal-length lines can be passed as read.  The `YYYY-MM-DDThh:mm:ss`
+ * head is validated with word-wide (SWAR) digit checks; records using `t` or
+ * a space as separator take the scalar path and parse identically.
+ *
+ * @throws TempochException if `buffer.size() != stride * out.size()`.
+ */
+inline BatchStatus parse_iso8601_fixed(std::string_view buffer, std::size_t stride,
+                                       span<CivilTime> out) {
+  detail::ensure_same_length(buffer.size(), stride * out.size(), "tempoch::parse_iso8601_fixed");
+  BatchStatus status(out.size());
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    const char *record = buffer.data() + i * stride;
+    std::size_t length = stride;
+    while (length > 0 &&
+           (record[length - 1] == '\n' || record[length - 1] == '\r' || record[length - 1] == ' '))
+      --length;
+    CivilTime c;
+    tempoch_status_t s = TEMPOCH_STATUS_T_CONVERSION_FAILED;
+    if (length >= detail::kIso8601HeadLength &&
+        (detail::parse_iso8601_head_swar(record, &c) || detail::parse_iso8601_head(record, &c)))
+      s = detail::parse_iso8601_tail(record + detail::kIso8601HeadLength, record + length, &c);
+    if (s == TEMPOCH_STATUS_T_OK)
+      out[i] = c;
+    else
+      status.set(i, s);
+  }
+  return status;
+}
+
+} // namespace tempoch
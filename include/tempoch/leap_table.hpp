@@ -0,0 +1,395 @@
+#pragma once
+
+/**
+ * @file leap_table.hpp
+ * @brief In-process snapshot of the active leap-second table.
+ *
+ * Since 1972 TAI − UTC is an integral constant between leap seconds, and
+ * leap seconds only ever fall at a month boundary.  The C ABI has no
+ * leap-table export, so the snapshot is built by sampling tempoch-ffi once per
+ * UTC month: for each month it records the UTC split offset of the month start
+ * (resolved by the engine itself), TAI − UTC, and the Unix − UTC encoding
+ * offset.  A month is kept only when both ends agree on every offset and the
+ * inverse route round-trips exactly.  Consecutive months with equal offsets
+ * are merged, which leaves a few dozen intervals.
+ *
+ * UTC ↔ TAI (and the fixed-offset scales behind TAI), and UTC ↔ Unix
+ * encoding, then resolve with a lookup that first tries the calling thread's
+ * last interval.  Instants within `kLeapGuardSeconds` of an interval edge,
+ * before 1972, after `kLeapTableEndYear`, or in a month that failed
+ * validation still go through tempoch-ffi, as does the leap second itself.
+ *
+ * The snapshot is keyed on the `tempoch_time_data_status()` fingerprint
+ * (horizons plus `source`).  Every lookup compares the calling thread's copy
+ * against the registry generation, one atomic load.  The wrapper's time-data
+ * entry points (`time_data_status()`, `time_data_fingerprint()` and
+ * `TimeContext::with_builtin_eop()`) re-read the fingerprint and replace a
+ * snapshot that no longer matches.  A bundle switched outside this wrapper is
+ * only seen after `refresh_leap_table()`.
+ *
+ * Building costs roughly 14 000 tempoch-ffi calls (128 years × 12 months), so
+ * lookups never build: they go through tempoch-ffi until a snapshot exists.
+ * It is built eagerly by `refresh_leap_table()`, by the first `TimeContext`
+ * (or `try_to()` default context) and by the time-data entry points above,
+ * without holding any lock that lookups take; the result is published with an
+ * atomic `shared_ptr` store.  A build that fails is not retried for the same
+ * bundle except by `refresh_leap_table()`.  Call `refresh_leap_table()` at
+ * start-up when only context-free conversions are used.
+ */
+
+#include "ffi_core.hpp"
+#include "split_arith.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace tempoch {
+namespace detail {
+
+/// First UTC year sampled; before it TAI − UTC was not an integral step.
+inline constexpr int32_t kLeapTableStartYear = 1972;
+/// Last UTC year sampled (exclusive).
+inline constexpr int32_t kLeapTableEndYear = 2100;
+/// Distance from an interval edge inside which lookups defer to tempoch-ffi.
+inline constexpr double kLeapGuardSeconds = 2.0;
+
+/// A run of UTC months sharing the same offsets.
+struct LeapInterval {
+  /// UTC split seconds of the first instant of the run.
+  double utc_begin;
+  /// UTC split seconds of the first instant after the run.
+  double utc_end;
+  /// TAI − UTC within the run, in seconds.
+  double tai_minus_utc;
+  /// Unix − UTC split seconds within the run.
+  double unix_minus_utc;
+
+  double tai_begin() const noexcept { return utc_begin + tai_minus_utc; }
+  double tai_end() const noexcept { return utc_end + tai_minus_utc; }
+  double unix_begin() const noexcept { return utc_begin + unix_minus_utc; }
+  double unix_end() const noexcept { return utc_end + unix_minus_utc; }
+};
+
+inline bool same_horizon(double a, double b) noexcept {
+  return a == b || (std::isnan(a) && std::isnan(b));
+}
+
+inline bool same_fingerprint(const TempochDataHorizons &a, const TempochDataHorizons &b) noexcept {
+  return a.source == b.source && same_horizon(a.eop_start_mjd, b.eop_start_mjd) &&
+         same_horizon(a.eop_observed_end_mjd, b.eop_observed_end_mjd) &&
+         same_horizon(a.eop_end_mjd, b.eop_end_mjd) &&
+         same_horizon(a.modern_delta_t_observed_end_mjd, b.modern_delta_t_observed_end_mjd) &&
+         same_horizon(a.delta_t_prediction_horizon_mjd, b.delta_t_prediction_horizon_mjd);
+}
+
+/// Immutable snapshot of the leap-second intervals for one time-data bundle.
+class LeapTable {
+public:
+  LeapTable() = default;
+
+  /// Sample tempoch-ffi month by month and merge equal runs.
+  static std::shared_ptr<const LeapTable> build(const TempochDataHorizons &fingerprint) {
+    auto table = std::make_shared<LeapTable>();
+    table->fingerprint_ = fingerprint;
+
+    double month_begin = 0.0;
+    bool have_begin = month_start(kLeapTableStartYear, 1, &month_begin);
+    for (int32_t year = kLeapTableStartYear; year < kLeapTableEndYear; ++year) {
+      for (uint8_t month = 1; month <= 12; ++month) {
+        double month_end = 0.0;
+        const bool have_end = month == 12 ? month_start(year + 1, 1, &month_end)
+                                          : month_start(year, static_cast<uint8_t>(month + 1),
+                                                        &month_end);
+        double tai_minus_utc = 0.0;
+        double unix_minus_utc = 0.0;
+        if (have_begin && have_end &&
+            sample_month(month_begin, month_end, &tai_minus_utc, &unix_minus_utc)) {
+          table->append(month_begin, month_end, tai_minus_utc, unix_minus_utc);
+        }
+        month_begin = month_end;
+        have_begin = have_end;
+      }
+    }
+    table->unix_axis_sorted_ =
+        std::is_sorted(table->intervals_.begin(), table->intervals_.end(),
+                       [](const LeapInterval &a, const LeapInterval &b) {
+                         return a.unix_begin() < b.unix_begin();
+                       });
+    return table;
+  }
+
+  const TempochDataHorizons &fingerprint() const noexcept { return fingerprint_; }
+  const std::vector<LeapInterval> &intervals() const noexcept { return intervals_; }
+
+  /// Interval whose guarded interior holds UTC split seconds @p utc, or nullptr.
+  const LeapInterval *find_utc(double utc, std::size_t &hint) const noexcept {
+    return find(utc, hint, [](const LeapInterval &i) { return i.utc_begin; },
+                [](const LeapInterval &i) { return i.utc_end; });
+  }
+
+  /// Interval whose guarded interior holds TAI split seconds @p tai, or nullptr.
+  const LeapInterval *find_tai(double tai, std::size_t &hint) const noexcept {
+    return find(tai, hint, [](const LeapInterval &i) { return i.tai_begin(); },
+                [](const LeapInterval &i) { return i.tai_end(); });
+  }
+
+  /// Interval whose guarded interior holds Unix seconds @p unix_seconds, or nullptr.
+  const LeapInterval *find_unix(double unix_seconds, std::size_t &hint) const noexcept {
+    if (!unix_axis_sorted_)
+      return nullptr;
+    return find(unix_seconds, hint, [](const LeapInterval &i) { return i.unix_begin(); },
+                [](const LeapInterval &i) { return i.unix_end(); });
+  }
+
+private:
+  TempochDataHorizons fingerprint_{};
+  std::vector<LeapInterval> intervals_;
+  bool unix_axis_sorted_ = false;
+
+  static bool month_start(int32_t year, uint8_t month, double *out) noexcept {
+    tempoch_time_t split{};
+    if (TEMPOCH_FFI_CALL(tempoch_time_from_civil)(tempoch_utc_t{year, month, 1, 0, 0, 0, 0},
+                                                  nullptr, &split) != TEMPOCH_STATUS_T_OK)
+      return false;
+    *out = split.hi_seconds + split.lo_seconds;
+    return true;
+  }
+
+  /// Offsets at @p utc, verified through the inverse routes.
+  static bool sample(double utc, double *tai_minus_utc, double *unix_minus_utc) noexcept {
+    const tempoch_time_t at = make_split(utc, 0.0);
+    tempoch_time_t tai{};
+    tempoch_time_t back{};
+    double unix_seconds = 0.0;
+    if (TEMPOCH_FFI_CALL(tempoch_time_scale_convert)(at, TEMPOCH_SCALE_TAG_T_UTC,
+                                                     TEMPOCH_SCALE_TAG_T_TAI, nullptr,
+                                                     &tai) != TEMPOCH_STATUS_T_OK ||
+        TEMPOCH_FFI_CALL(tempoch_time_scale_convert)(tai, TEMPOCH_SCALE_TAG_T_TAI,
+                                                     TEMPOCH_SCALE_TAG_T_UTC, nullptr,
+                                                     &back) != TEMPOCH_STATUS_T_OK ||
+        split_difference(back, at) != 0.0)
+      return false;
+    if (TEMPOCH_FFI_CALL(tempoch_time_to_format)(at, TEMPOCH_SCALE_TAG_T_UTC,
+                                                 TEMPOCH_FORMAT_TAG_T_UNIX, nullptr,
+                                                 &unix_seconds) != TEMPOCH_STATUS_T_OK ||
+        TEMPOCH_FFI_CALL(tempoch_time_from_format)(unix_seconds, TEMPOCH_SCALE_TAG_T_UTC,
+                                                   TEMPOCH_FORMAT_TAG_T_UNIX, nullptr,
+                                                   &back) != TEMPOCH_STATUS_T_OK ||
+        split_difference(back, at) != 0.0)
+      return false;
+    *tai_minus_utc = split_difference(tai, at);
+    *unix_minus_utc = unix_seconds - utc;
+    // Offsets must be whole seconds for the native additions to be exact.
+    return std::trunc(*tai_minus_utc) == *tai_minus_utc &&
+           std::trunc(*unix_minus_utc) == *unix_minus_utc;
+  }
+
+  static bool sample_month(double begin, double end, double *tai_minus_utc,
+                           double *unix_minus_utc) noexcept {
+    double tai_late = 0.0;
+    double unix_late = 0.0;
+    return end - begin > 2.0 * kLeapGuardSeconds &&
+           sample(begin + kLeapGuardSeconds, tai_minus_utc, unix_minus_utc) &&
+           sample(end - kLeapGuardSeconds, &tai_late, &unix_late) &&
+           tai_late == *tai_minus_utc && unix_late == *unix_minus_utc;
+  }
+
+  void append(double begin, double end, double tai_minus_utc, double unix_minus_utc) {
+    if (!intervals_.empty()) {
+      LeapInterval &last = intervals_.back();
+      if (last.utc_end == begin && last.tai_minus_utc == tai_minus_utc &&
+          last.unix_minus_utc == unix_minus_utc) {
+        last.utc_end = end;
+        return;
+      }
+    }
+    intervals_.push_back(LeapInterval{begin, end, tai_minus_utc, unix_minus_utc});
+  }
+
+  template <typename Begin, typename End>
+  const LeapInterval *find(double x, std::size_t &hint, Begin begin, End end) const noexcept {
+    const auto inside = [&](const LeapInterval &i) {
+      return x >= begin(i) + kLeapGuardSeconds && x < end(i) - kLeapGuardSeconds;
+    };
+    if (hint < intervals_.size() && inside(intervals_[hint]))
+      return &intervals_[hint];
+    auto it = std::upper_bound(intervals_.begin(), intervals_.end(), x,
+                               [&](double v, const LeapInterval &i) { return v < begin(i); });
+    if (it == intervals_.begin())
+      return nullptr;
+    --it;
+    if (!inside(*it))
+      return nullptr;
+    hint = static_cast<std::size_t>(it - intervals_.begin());
+    return &*it;
+  }
+};
+
+/// Fingerprint of the active time-data bundle; all zero if it cannot be read.
+inline TempochDataHorizons active_time_data_fingerprint() noexcept {
+  TempochDataHorizons fingerprint{};
+  if (TEMPOCH_FFI_CALL(tempoch_time_data_status)(&fingerprint) != TEMPOCH_STATUS_T_OK)
+    fingerprint = TempochDataHorizons{};
+  return fingerprint;
+}
+
+/// Process-wide snapshot slot, bumped on every publish or invalidation.
+///
+/// `table` is only accessed through `std::atomic_load` / `std::atomic_store`.
+/// `build_mutex` serialises builders and guards the failed-build record;
+/// lookups never take it.
+struct LeapTableRegistry {
+  std::mutex build_mutex;
+  std::shared_ptr<const LeapTable> table;
+  std::atomic<uint64_t> generation{0};
+  /// Whether the last build failed, and for which bundle.
+  bool build_failed = false;
+  TempochDataHorizons failed_fingerprint{};
+
+  static LeapTableRegistry &instance() {
+    static LeapTableRegistry registry;
+    return registry;
+  }
+
+  std::shared_ptr<const LeapTable> current() const noexcept { return std::atomic_load(&table); }
+
+  /// Build from the active bundle and publish it, waiting for any other builder.
+  ///
+  /// Returns nullptr, publishing nothing, if the bundle moved mid-build.
+  std::shared_ptr<const LeapTable> rebuild() {
+    std::lock_guard<std::mutex> lock(build_mutex);
+    return build_locked(active_time_data_fingerprint());
+  }
+
+  /// Build unless a snapshot exists, another thread is building, or the last
+  /// build failed for the active bundle.
+  void ensure_built() noexcept {
+    if (current())
+      return;
+    std::unique_lock<std::mutex> lock(build_mutex, std::try_to_lock);
+    if (!lock.owns_lock() || current())
+      return;
+    const TempochDataHorizons fingerprint = active_time_data_fingerprint();
+    if (build_failed && same_fingerprint(failed_fingerprint, fingerprint))
+      return;
+    try {
+      build_locked(fingerprint);
+    } catch (...) {
+      build_failed = true;
+      failed_fingerprint = fingerprint;
+    }
+  }
+
+  /// Replace the snapshot if it was not built from the bundle @p fingerprint,
+  /// and build one if there is none.
+  void observe(const TempochDataHorizons &fingerprint) noexcept {
+    const std::shared_ptr<const LeapTable> snapshot = current();
+    if (snapshot && same_fingerprint(snapshot->fingerprint(), fingerprint))
+      return;
+    if (snapshot) {
+      std::atomic_store(&table, std::shared_ptr<const LeapTable>());
+      generation.fetch_add(1, std::memory_order_release);
+    }
+    ensure_built();
+  }
+
+private:
+  /// Caller holds `build_mutex`.
+  std::shared_ptr<const LeapTable> build_locked(const TempochDataHorizons &fingerprint) {
+    build_failed = true;
+    failed_fingerprint = fingerprint;
+    std::shared_ptr<const LeapTable> fresh = LeapTable::build(fingerprint);
+    if (!same_fingerprint(fingerprint, active_time_data_fingerprint()))
+      return nullptr;
+    build_failed = false;
+    std::atomic_store(&table, fresh);
+    generation.fetch_add(1, std::memory_order_release);
+    return fresh;
+  }
+};
+
+/// Per-thread view of the registry plus the last interval hit.
+struct LeapCursor {
+  std::shared_ptr<const LeapTable> table;
+  uint64_t generation = ~uint64_t{0};
+  std::size_t hint = 0;
+};
+
+/// Current snapshot for this thread, or nullptr while it is unavailable.
+inline const LeapTable *leap_table_for_thread(LeapCursor &cursor) noexcept {
+  LeapTableRegistry &registry = LeapTableRegistry::instance();
+  const uint64_t generation = registry.generation.load(std::memory_order_acquire);
+  if (cursor.generation != generation) {
+    cursor.table = registry.current();
+    cursor.generation = generation;
+    cursor.hint = 0;
+  }
+  return cursor.table.get();
+}
+
+inline LeapCursor &thread_leap_cursor() noexcept {
+  thread_local LeapCursor cursor;
+  return cursor;
+}
+
+/// TAI − UTC at UTC split seconds @p utc, when the snapshot can answer it.
+inline bool leap_tai_minus_utc(double utc, double *out) noexcept {
+  LeapCursor &cursor = thread_leap_cursor();
+  const LeapTable *table = leap_table_for_thread(cursor);
+  const LeapInterval *interval = table ? table->find_utc(utc, cursor.hint) : nullptr;
+  if (!interval)
+    return false;
+  *out = interval->tai_minus_utc;
+  return true;
+}
+
+/// TAI − UTC at TAI split seconds @p tai, when the snapshot can answer it.
+inline bool leap_tai_minus_utc_from_tai(double tai, double *out) noexcept {
+  LeapCursor &cursor = thread_leap_cursor();
+  const LeapTable *table = leap_table_for_thread(cursor);
+  const LeapInterval *interval = table ? table->find_tai(tai, cursor.hint) : nullptr;
+  if (!interval)
+    return false;
+  *out = interval->tai_minus_utc;
+  return true;
+}
+
+/// Unix − UTC split seconds at UTC split seconds @p utc.
+inline bool leap_unix_minus_utc(double utc, double *out) noexcept {
+  LeapCursor &cursor = thread_leap_cursor();
+  const LeapTable *table = leap_table_for_thread(cursor);
+  const LeapInterval *interval = table ? table->find_utc(utc, cursor.hint) : nullptr;
+  if (!interval)
+    return false;
+  *out = interval->unix_minus_utc;
+  return true;
+}
+
+/// Unix − UTC split seconds at Unix seconds @p unix_seconds.
+inline bool leap_unix_minus_utc_from_unix(double unix_seconds, double *out) noexcept {
+  LeapCursor &cursor = thread_leap_cursor();
+  const LeapTable *table = leap_table_for_thread(cursor);
+  const LeapInterval *interval = table ? table->find_unix(unix_seconds, cursor.hint) : nullptr;
+  if (!interval)
+    return false;
+  *out = interval->unix_minus_utc;
+  return true;
+}
+
+} // namespace detail
+
+/// Rebuild the leap-second snapshot from the active time-data bundle now.
+///
+/// Needed after a bundle is switched outside this wrapper, which the
+/// snapshot cannot observe, and the only way to retry a failed build for the
+/// same bundle.  Also pays the build cost up front when called at start-up.
+inline void refresh_leap_table() { detail::LeapTableRegistry::instance().rebuild(); }
+
+} // namespace tempoch
@@ -0,0 +1,79 @@
+#pragma once
+
+/**
+ * @file native_formats.hpp
+ * @brief Header-only transcoding between the day-count formats of one scale.
+ *
+ * JD and MJD on the same scale differ by the definitional 2 400 000.5 days,
+ * and J2000 seconds are the canonical split storage itself, so these format
+ * changes need no tempoch-ffi round trip.  All of these routes are limited to
+ * continuous scales: on UTC and UT1 the day count is subject to the
+ * leap-second / ΔT policy carried by a `TimeContext`, and the engine validates
+ * it on the way through, so even JD ↔ MJD stays there.  Of the Unix and GPS
+ * encodings only Unix on UTC and GPS on TAI skip it; see `try_encode_time` in
+ * time_base.hpp.
+ */
+
+#include "formats/formats.hpp"
+#include "scales/scales.hpp"
+#include "split_arith.hpp"
+
+#include <type_traits>
+
+namespace tempoch {
+namespace detail {
+
+/// JD of the J2000.0 epoch (2000-01-01T12:00:00 on the scale's own axis).
+inline constexpr double kJ2000JulianDate = 2'451'545.0;
+/// JD − MJD.
+inline constexpr double kMjdOffsetDays = 2'400'000.5;
+/// MJD of the J2000.0 epoch.
+inline constexpr double kJ2000ModifiedJulianDate = 51'544.5;
+inline constexpr double kSecondsPerJulianDay = 86'400.0;
+
+/// Scales whose J2000-second count needs no UTC / UT1 policy.
+template <typename S>
+inline constexpr bool is_continuous_scale_v =
+    !std::is_same_v<S, scale::UTC> && !std::is_same_v<S, scale::UT1>;
+
+template <typename F>
+inline constexpr bool is_day_count_format_v =
+    std::is_same_v<F, format::JD> || std::is_same_v<F, format::MJD>;
+
+/// True when `EncodedTime<S, From> → EncodedTime<S, To>` is resolved in the header.
+template <typename S, typename From, typename To>
+inline constexpr bool has_native_format_route_v =
+    !std::is_same_v<From, To> && is_continuous_scale_v<S> &&
+    ((is_day_count_format_v<From> && is_day_count_format_v<To>) ||
+     (is_day_count_format_v<From> && std::is_same_v<To, format::J2000s>) ||
+     (std::is_same_v<From, format::J2000s> && is_day_count_format_v<To>));
+
+/// True when split storage ↔ format @p F on scale @p S is resolved in the header.
+template <typename S, typename F>
+inline constexpr bool has_native_split_codec_v =
+    is_continuous_scale_v<S> && std::is_same_v<F, format::J2000s>;
+
+template <typename F> constexpr double day_count_epoch() noexcept {
+  if constexpr (std::is_same_v<F, format::JD>)
+    return kJ2000JulianDate;
+  else
+    return kJ2000ModifiedJulianDate;
+}
+
+/// Transcode a raw value; only valid when `has_native_format_route_v<S, From, To>`.
+template <typename S, typename From, typename To>
+constexpr double native_transcode(double raw) noexcept {
+  static_assert(has_native_format_route_v<S, From, To>, "no native route for this format pair");
+  if constexpr (std::is_same_v<From, format::JD> && std::is_same_v<To, format::MJD>) {
+    return raw - kMjdOffsetDays;
+  } else if constexpr (std::is_same_v<From, format::MJD> && std::is_same_v<To, format::JD>) {
+    return raw + kMjdOffsetDays;
+  } else if constexpr (std::is_same_v<To, format::J2000s>) {
+    return (raw - day_count_epoch<From>()) * kSecondsPerJulianDay;
+  } else {
+    return day_count_epoch<To>() + raw / kSecondsPerJulianDay;
+  }
+}
+
+} // namespace detail
+} // namespace tempoch
@@ -0,0 +1,84 @@
+#pragma once
+
+/**
+ * @file native_scales.hpp
+ * @brief Header-only routes for scale pairs related by exact affine maps.
+ *
+ * TAI, TT and the GNSS coordinate scales (GPST, GST, QZSST, BDT) differ by
+ * constant offsets.  Conversions between any of these are resolved at compile
+ * time into compensated additions on the split pair instead of a
+ * `tempoch_time_scale_convert` call, and match tempoch-ffi bit for bit.  Every
+ * other pair (UTC, UT1, TDB, TCG, TCB, ET) still routes through tempoch-ffi;
+ * TCG is linear in TT, but the rate term rounds differently depending on how
+ * it is evaluated, so it stays with the engine.
+ */
+
+#include "scales/scales.hpp"
+#include "split_arith.hpp"
+
+#include <type_traits>
+
+namespace tempoch {
+namespace detail {
+
+/// Scales reachable from TAI by a constant offset: `value_S = value_TAI + offset`.
+template <typename S> struct FixedOffsetScale : std::false_type {};
+
+template <> struct FixedOffsetScale<scale::TAI> : std::true_type {
+  static constexpr double offset_from_tai = 0.0;
+};
+/// TT − TAI = 32.184 s.
+template <> struct FixedOffsetScale<scale::TT> : std::true_type {
+  static constexpr double offset_from_tai = 32.184;
+};
+/// GPST = TAI − 19 s.
+template <> struct FixedOffsetScale<scale::GPST> : std::true_type {
+  static constexpr double offset_from_tai = -19.0;
+};
+/// Galileo System Time is steered to GPST.
+template <> struct FixedOffsetScale<scale::GST> : std::true_type {
+  static constexpr double offset_from_tai = -19.0;
+};
+/// QZSS System Time is aligned with GPST.
+template <> struct FixedOffsetScale<scale::QZSST> : std::true_type {
+  static constexpr double offset_from_tai = -19.0;
+};
+/// BDT = TAI − 33 s (GPST − 14 s).
+template <> struct FixedOffsetScale<scale::BDT> : std::true_type {
+  static constexpr double offset_from_tai = -33.0;
+};
+
+template <typename S>
+inline constexpr bool is_fixed_offset_scale_v = FixedOffsetScale<S>::value;
+
+template <typename S> inline constexpr bool is_native_scale_v = is_fixed_offset_scale_v<S>;
+
+/// True when `From → To` is resolved in the header without tempoch-ffi.
+template <typename From, typename To>
+inline constexpr bool has_native_scale_route_v =
+    !std::is_same_v<From, To> && is_native_scale_v<From> && is_native_scale_v<To>;
+
+/// Apply the offset between two fixed-offset scales as two compensated steps via TAI.
+///
+/// Scales sharing an offset (GPST, GST, QZSST) still take both steps: like the
+/// engine, the result comes back normalised rather than as the input pair.
+constexpr tempoch_time_t shift_fixed_offset(const tempoch_time_t &value, double from_offset,
+                                            double to_offset) noexcept {
+  tempoch_time_t out = value;
+  if (from_offset != 0.0)
+    out = split_add(out, -from_offset);
+  if (to_offset != 0.0)
+    out = split_add(out, to_offset);
+  return out;
+}
+
+/// Convert along a native route; only valid when `has_native_scale_route_v<From, To>`.
+template <typename From, typename To>
+constexpr tempoch_time_t native_scale_convert(const tempoch_time_t &value) noexcept {
+  static_assert(has_native_scale_route_v<From, To>, "no native route for this scale pair");
+  return shift_fixed_offset(value, FixedOffsetScale<From>::offset_from_tai,
+                            FixedOffsetScale<To>::offset_from_tai);
+}
+
+} // namespace detail
+} // namespace tempoch
@@ -0,0 +1,246 @@
+#pragma once
+
+/**
+ * @file parallel.hpp
+ * @brief Multi-threaded overloads of the period list operations.
+ *
+ * Pass `tempoch::par` as the first argument to run an operation on a pool of
+ * `std::thread` workers created for that call:
+ *
+ * @code
+ * auto merged = tempoch::normalize_periods(tempoch::par, windows);
+ * auto merged8 = tempoch::normalize_periods(tempoch::par.with_threads(8), windows);
+ * @endcode
+ *
+ * `normalize_periods(par, ...)` sample-sorts the periods into one start range
+ * per worker, sorts and merges every range independently, and stitches the
+ * ranges together, merging across their boundaries.  Periods are merged on
+ * the endpoints they store (see `detail::PeriodBounds`), so no endpoint goes
+ * through tempoch-ffi.  For MJD-stored periods the result is identical to the
+ * serial overload; `Time<S>` periods keep their split endpoints instead of the
+ * MJD round trip the serial list operations make.  Lists below
+ * `kParallelNormalizeMinSize` periods use the serial path directly, because
+ * starting the workers would cost more than it saves.
+ */
+
+#include "period.hpp"
+#include "result.hpp"
+#include "span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace tempoch {
+
+/// Execution policy selecting the multi-threaded overloads.
+struct ParallelPolicy {
+  /// Worker count; 0 means `std::thread::hardware_concurrency()`.
+  unsigned threads = 0;
+
+  constexpr ParallelPolicy with_threads(unsigned n) const noexcept { return ParallelPolicy{n}; }
+
+  unsigned resolved_threads() const noexcept {
+    if (threads != 0)
+      return threads;
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw == 0 ? 1 : hw;
+  }
+};
+
+inline constexpr ParallelPolicy par{};
+
+/// Lists shorter than this are normalized on the calling thread.
+inline constexpr std::size_t kParallelNormalizeMinSize = std::size_t{1} << 16;
+
+namespace detail {
+
+/// Run `fn(0) ... fn(workers - 1)` concurrently; `fn(0)` runs on the calling thread.
+template <typename Fn> void parallel_for(unsigned workers, const Fn &fn) {
+  struct Joiner {
+    std::vector<std::thread> threads;
+    ~Joiner() {
+      for (auto &t : threads)
+        t.join();
+    }
+  } pool;
+  pool.threads.reserve(workers - 1);
+  for (unsigned w = 1; w < workers; ++w)
+    pool.threads.emplace_back([&fn, w] { fn(w); });
+  fn(0);
+}
+
+inline std::size_t chunk_begin(std::size_t n, unsigned chunks, unsigned i) noexcept {
+  return static_cast<std::size_t>(static_cast<unsigned long long>(n) * i / chunks);
+}
+
+/// A period as the pair of endpoint keys it is merged on; see `PeriodBounds`.
+template <typename K> struct EndpointPair {
+  K start;
+  K end;
+};
+
+/**
+ * Sort and merge @p in on @p workers threads and hand each merged period to
+ * @p emit in order.  Periods are bucketed by start using splitters drawn from
+ * a regular sample, so bucket `b` holds only starts below those of bucket
+ * `b + 1`, and merging the per-bucket results front to back is equivalent to
+ * merging the globally sorted list.
+ */
+template <typename T, typename Emit>
+tempoch_status_t normalize_periods_parallel(span<const Period<T>> in, unsigned workers,
+                                            const Emit &emit) {
+  using Bounds = PeriodBounds<T>;
+  using Key = typename Bounds::endpoint_type;
+  using Pair = EndpointPair<Key>;
+  constexpr unsigned kOversample = 32;
+  const std::size_t n = in.size();
+  const auto start_of = [&](std::size_t i) { return Bounds::start_key(in[i].storage()); };
+  const auto pair_of = [&](std::size_t i) {
+    return Pair{Bounds::start_key(in[i].storage()), Bounds::end_key(in[i].storage())};
+  };
+  const auto before = [](const Key &a, const Key &b) { return endpoint_less(a, b); };
+
+  std::vector<char> invalid(workers, 0);
+  parallel_for(workers, [&](unsigned w) {
+    for (std::size_t i = chunk_begin(n, workers, w); i < chunk_begin(n, workers, w + 1); ++i) {
+      const Pair p = pair_of(i);
+      if (!endpoint_less_equal(p.start, p.end)) {
+        invalid[w] = 1;
+        return;
+      }
+    }
+  });
+  if (std::find(invalid.begin(), invalid.end(), 1) != invalid.end())
+    return TEMPOCH_STATUS_T_INVALID_PERIOD;
+
+  std::vector<Key> sample(static_cast<std::size_t>(workers) * kOversample);
+  for (std::size_t i = 0; i < sample.size(); ++i)
+    sample[i] =
+        start_of(chunk_begin(n, static_cast<unsigned>(sample.size()), static_cast<unsigned>(i)));
+  std::sort(sample.begin(), sample.end(), before);
+  std::vector<Key> splitters(workers - 1);
+  for (unsigned b = 0; b + 1 < workers; ++b)
+    splitters[b] = sample[(b + 1) * kOversample];
+  const auto bucket_of = [&](const Key &start) {
+    return static_cast<std::size_t>(
+        std::upper_bound(splitters.begin(), splitters.end(), start, before) - splitters.begin());
+  };
+
+  // offsets[w * workers + b]: where chunk w writes its bucket-b periods.
+  std::vector<std::size_t> offsets(static_cast<std::size_t>(workers) * workers, 0);
+  parallel_for(workers, [&](unsigned w) {
+    std::size_t *counts = &offsets[static_cast<std::size_t>(w) * workers];
+    for (std::size_t i = chunk_begin(n, workers, w); i < chunk_begin(n, workers, w + 1); ++i)
+      ++counts[bucket_of(start_of(i))];
+  });
+  std::vector<std::size_t> bucket_begin(workers + 1, 0);
+  std::size_t running = 0;
+  for (unsigned b = 0; b < workers; ++b) {
+    bucket_begin[b] = running;
+    for (unsigned w = 0; w < workers; ++w) {
+      std::size_t &slot = offsets[static_cast<std::size_t>(w) * workers + b];
+      const std::size_t count = slot;
+      slot = running;
+      running += count;
+    }
+  }
+  bucket_begin[workers] = running;
+
+  std::vector<Pair> buf(n);
+  parallel_for(workers, [&](unsigned w) {
+    std::size_t *next = &offsets[static_cast<std::size_t>(w) * workers];
+    for (std::size_t i = chunk_begin(n, workers, w); i < chunk_begin(n, workers, w + 1); ++i) {
+      const Pair p = pair_of(i);
+      buf[next[bucket_of(p.start)]++] = p;
+    }
+  });
+
+  // Sort and merge each bucket in place; merged[b] is its merged length.
+  std::vector<std::size_t> merged(workers, 0);
+  parallel_for(workers, [&](unsigned b) {
+    Pair *first = buf.data() + bucket_begin[b];
+    Pair *last = buf.data() + bucket_begin[b + 1];
+    if (first == last)
+      return;
+    std::sort(first, last, [&](const Pair &x, const Pair &y) { return before(x.start, y.start); });
+    Pair *tail = first;
+    for (Pair *p = first + 1; p != last; ++p) {
+      if (endpoint_less_equal(p->start, tail->end))
+        tail->end = endpoint_max(tail->end, p->end);
+      else
+        *++tail = *p;
+    }
+    merged[b] = static_cast<std::size_t>(tail - first) + 1;
+  });
+
+  // Stitch the buckets, merging a period that runs into the next bucket.
+  bool pending = false;
+  Pair current{};
+  for (unsigned b = 0; b < workers; ++b) {
+    const Pair *p = buf.data() + bucket_begin[b];
+    for (std::size_t i = 0; i < merged[b]; ++i) {
+      if (pending && endpoint_less_equal(p[i].start, current.end)) {
+        current.end = endpoint_max(current.end, p[i].end);
+        continue;
+      }
+      if (pending)
+        emit(Period<T>::from_storage(Bounds::make(current.start, current.end)));
+      current = p[i];
+      pending = true;
+    }
+  }
+  if (pending)
+    emit(Period<T>::from_storage(Bounds::make(current.start, current.end)));
+  return TEMPOCH_STATUS_T_OK;
+}
+
+/// Workers worth starting for @p n periods, or 1 for the serial path.
+inline unsigned normalize_workers(const ParallelPolicy &policy, std::size_t n) noexcept {
+  if (n < kParallelNormalizeMinSize)
+    return 1;
+  const std::size_t cap = n / (kParallelNormalizeMinSize / 4);
+  return static_cast<unsigned>(std::min<std::size_t>(policy.resolved_threads(), cap));
+}
+
+} // namespace detail
+
+/// Multi-threaded `normalize_periods`; see the file comment for how it compares to the serial one.
+template <typename T, typename OutputIt>
+inline OutputIt normalize_periods(const ParallelPolicy &policy, span<const Period<T>> periods,
+                                  OutputIt out) {
+  const unsigned workers = detail::normalize_workers(policy, periods.size());
+  if (workers <= 1)
+    return normalize_periods(periods, out);
+  check_status(detail::normalize_periods_parallel(periods, workers,
+                                                  [&out](const Period<T> &p) { *out++ = p; }),
+               "normalize_periods");
+  return out;
+}
+
+template <typename T>
+inline std::vector<Period<T>> normalize_periods(const ParallelPolicy &policy,
+                                                const std::vector<Period<T>> &periods) {
+  std::vector<Period<T>> result;
+  normalize_periods(policy, span<const Period<T>>(periods), std::back_inserter(result));
+  return result;
+}
+
+template <typename T>
+inline Result<std::vector<Period<T>>>
+checked_normalize_periods(const ParallelPolicy &policy, const std::vector<Period<T>> &periods) {
+  const unsigned workers = detail::normalize_workers(policy, periods.size());
+  if (workers <= 1)
+    return checked_normalize_periods(periods);
+  std::vector<Period<T>> result;
+  const tempoch_status_t status =
+      detail::normalize_periods_parallel(span<const Period<T>>(periods), workers,
+                                         [&result](const Period<T> &p) { result.push_back(p); });
+  if (status != TEMPOCH_STATUS_T_OK)
+    return Error{status, "normalize_periods"};
+  return result;
+}
+
+} // namespace tempoch
@@ -6,19 +6,61 @@
  */
 
 #include "qtty/qtty.hpp"
+#include "span.hpp"
 #include "time.hpp"
+
+#include <algorithm>
+#include <iterator>
 #include <ostream>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace tempoch {
 
+namespace detail {
+
+/// MJD of split storage on scale @p S; resolved in the header on continuous scales.
+template <typename S>
+inline tempoch_status_t try_split_to_mjd(const tempoch_time_t &value, double *out) noexcept {
+  if constexpr (is_continuous_scale_v<S>) {
+    *out = native_transcode<S, format::J2000s, format::MJD>(value.hi_seconds + value.lo_seconds);
+    return TEMPOCH_STATUS_T_OK;
+  } else {
+    return try_encode_time<S, format::MJD>(value, nullptr, out);
+  }
+}
+
+/// Split storage of an MJD on scale @p S; resolved in the header on continuous scales.
+template <typename S>
+inline tempoch_status_t try_split_from_mjd(double mjd, tempoch_time_t *out) noexcept {
+  if constexpr (is_continuous_scale_v<S>) {
+    if (!std::isfinite(mjd))
+      return TEMPOCH_STATUS_T_CONVERSION_FAILED;
+    *out = make_split(native_transcode<S, format::MJD, format::J2000s>(mjd), 0.0);
+    return TEMPOCH_STATUS_T_OK;
+  } else {
+    return try_decode_time<S, format::MJD>(mjd, nullptr, out);
+  }
+}
+
+} // namespace detail
+
 template <typename S> struct TimeTraits<Time<S>> {
   static double to_mjd_value(const Time<S> &time) {
-    return time.template to<format::MJD>().value();
+    double mjd = 0.0;
+    check_status(detail::try_split_to_mjd<S>(time.c_inner(), &mjd), "tempoch_time_to_format");
+    return mjd;
+  }
+
+  static tempoch_status_t try_to_mjd_value(const Time<S> &time, double *out) noexcept {
+    return detail::try_split_to_mjd<S>(time.c_inner(), out);
   }
 
   static Time<S> from_mjd_value(double mjd) {
-    return Time<S>::from_encoded(ModifiedJulianDate<S>(mjd));
+    tempoch_time_t split{};
+    check_status(detail::try_split_from_mjd<S>(mjd, &split), "tempoch_time_from_format");
+    return Time<S>::from_c(split);
   }
 };
 
@@ -27,7 +69,23 @@ template <typename S, typename F> struct TimeTraits<EncodedTime<S, F>> {
     if constexpr (std::is_same_v<F, format::MJD>) {
       return time.value();
     } else {
-      return Time<S>::from_encoded(time).template to<format::MJD>().value();
+      return time.template to<format::MJD>().value();
+    }
+  }
+
+  static tempoch_status_t try_to_mjd_value(const EncodedTime<S, F> &time, double *out) noexcept {
+    if constexpr (std::is_same_v<F, format::MJD>) {
+      *out = time.value();
+      return TEMPOCH_STATUS_T_OK;
+    } else if constexpr (detail::has_native_format_route_v<S, F, format::MJD>) {
+      *out = detail::native_transcode<S, F, format::MJD>(time.value());
+      return TEMPOCH_STATUS_T_OK;
+    } else {
+      tempoch_time_t split{};
+      const tempoch_status_t status = detail::try_decode_time<S, F>(time.value(), nullptr, &split);
+      if (status != TEMPOCH_STATUS_T_OK)
+        return status;
+      return detail::try_encode_time<S, format::MJD>(split, nullptr, out);
     }
   }
 
@@ -45,11 +103,21 @@ template <> struct TimeTraits<CivilTime> {
     return Time<scale::UTC>::from_civil(time).template to<format::MJD>().value();
   }
 
+  static tempoch_status_t try_to_mjd_value(const CivilTime &time, double *out) noexcept {
+    tempoch_time_t split{};
+    const tempoch_status_t status = detail::try_time_from_civil(time, nullptr, &split);
+    if (status != TEMPOCH_STATUS_T_OK)
+      return status;
+    return detail::try_encode_time<scale::UTC, format::MJD>(split, nullptr, out);
+  }
+
   static CivilTime from_mjd_value(double mjd) {
     return Time<scale::UTC>::from_encoded(ModifiedJulianDate<scale::UTC>(mjd)).to_civil();
   }
 };
 
+template <typename T> class Period;
+
 namespace detail {
 
 template <typename Target, typename T> auto convert_period_endpoint(const T &value) {
@@ -87,12 +155,437 @@ auto convert_period_endpoint_with(const T &value, const TimeContext &ctx) {
   }
 }
 
+// -- Scalar period algebra ------------------------------------------------------
+//
+// Same half-open [start, end) semantics and status codes as the tempoch-ffi
+// `tempoch_period_mjd_*` entry points, evaluated in the header.  NaN endpoints
+// fail every ordered comparison and are therefore rejected as invalid.
+
+constexpr tempoch_status_t period_new(double start_mjd, double end_mjd,
+                                      tempoch_period_mjd_t *out) noexcept {
+  if (!(start_mjd <= end_mjd))
+    return TEMPOCH_STATUS_T_INVALID_PERIOD;
+  *out = tempoch_period_mjd_t{start_mjd, end_mjd};
+  return TEMPOCH_STATUS_T_OK;
+}
+
+constexpr bool period_contains(const tempoch_period_mjd_t &p, double mjd) noexcept {
+  return p.start_mjd <= mjd && mjd < p.end_mjd;
+}
+
+/// Overlap of @p a and @p b; empty or touching periods report `NO_INTERSECTION`.
+constexpr tempoch_status_t period_intersection(const tempoch_period_mjd_t &a,
+                                               const tempoch_period_mjd_t &b,
+                                               tempoch_period_mjd_t *out) noexcept {
+  const double start = a.start_mjd < b.start_mjd ? b.start_mjd : a.start_mjd;
+  const double end = a.end_mjd < b.end_mjd ? a.end_mjd : b.end_mjd;
+  if (!(start < end))
+    return TEMPOCH_STATUS_T_NO_INTERSECTION;
+  *out = tempoch_period_mjd_t{start, end};
+  return TEMPOCH_STATUS_T_OK;
+}
+
+/// Union of @p a and @p b in start order; overlapping or touching periods merge into one.
+constexpr std::size_t period_union(tempoch_period_mjd_t a, tempoch_period_mjd_t b,
+                                   tempoch_period_mjd_t out[2]) noexcept {
+  if (b.start_mjd < a.start_mjd) {
+    const tempoch_period_mjd_t t = a;
+    a = b;
+    b = t;
+  }
+  if (b.start_mjd <= a.end_mjd) {
+    out[0] = tempoch_period_mjd_t{a.start_mjd, a.end_mjd < b.end_mjd ? b.end_mjd : a.end_mjd};
+    return 1;
+  }
+  out[0] = a;
+  out[1] = b;
+  return 2;
+}
+
+// The same algebra on split endpoints, for `Period<Time<S>>`.  `tempoch_time_t`
+// pairs are normalised, so comparing (hi, lo) lexicographically orders them
+// exactly; a NaN high part fails every comparison, as above.
+
+/// Endpoints of a `Period<Time<S>>`, in the split J2000 seconds `Time<S>` stores.
+struct SplitPeriod {
+  tempoch_time_t start;
+  tempoch_time_t end;
+};
+
+constexpr bool split_less(const tempoch_time_t &a, const tempoch_time_t &b) noexcept {
+  return a.hi_seconds < b.hi_seconds ||
+         (a.hi_seconds == b.hi_seconds && a.lo_seconds < b.lo_seconds);
+}
+
+constexpr bool split_less_equal(const tempoch_time_t &a, const tempoch_time_t &b) noexcept {
+  return a.hi_seconds < b.hi_seconds ||
+         (a.hi_seconds == b.hi_seconds && a.lo_seconds <= b.lo_seconds);
+}
+
+constexpr tempoch_status_t period_new(const tempoch_time_t &start, const tempoch_time_t &end,
+                                      SplitPeriod *out) noexcept {
+  if (!split_less_equal(start, end))
+    return TEMPOCH_STATUS_T_INVALID_PERIOD;
+  *out = SplitPeriod{start, end};
+  return TEMPOCH_STATUS_T_OK;
+}
+
+constexpr bool period_contains(const SplitPeriod &p, const tempoch_time_t &t) noexcept {
+  return split_less_equal(p.start, t) && split_less(t, p.end);
+}
+
+constexpr tempoch_status_t period_intersection(const SplitPeriod &a, const SplitPeriod &b,
+                                               SplitPeriod *out) noexcept {
+  const tempoch_time_t start = split_less(a.start, b.start) ? b.start : a.start;
+  const tempoch_time_t end = split_less(a.end, b.end) ? a.end : b.end;
+  if (!split_less(start, end))
+    return TEMPOCH_STATUS_T_NO_INTERSECTION;
+  *out = SplitPeriod{start, end};
+  return TEMPOCH_STATUS_T_OK;
+}
+
+constexpr std::size_t period_union(SplitPeriod a, SplitPeriod b, SplitPeriod out[2]) noexcept {
+  if (split_less(b.start, a.start)) {
+    const SplitPeriod t = a;
+    a = b;
+    b = t;
+  }
+  if (split_less_equal(b.start, a.end)) {
+    out[0] = SplitPeriod{a.start, split_less(a.end, b.end) ? b.end : a.end};
+    return 1;
+  }
+  out[0] = a;
+  out[1] = b;
+  return 2;
+}
+
+// `UTCPeriod` keeps the civil labels it was built from next to the MJD pair.
+// The UTC MJD double resolves only ~0.6 µs, so endpoints are ordered by MJD
+// and, on an MJD tie, by their civil fields; the labels and the order they
+// describe therefore always agree.
+
+/// A civil UTC endpoint and its UTC MJD.
+struct CivilEndpoint {
+  double mjd;
+  CivilTime civil;
+};
+
+/// Endpoints of a `Period<CivilTime>`.
+struct CivilPeriod {
+  tempoch_period_mjd_t mjd;
+  CivilTime start;
+  CivilTime end;
+};
+
+/// Field-by-field order of two civil labels, most significant field first.
+inline bool civil_label_less(const CivilTime &a, const CivilTime &b) noexcept {
+  if (a.year != b.year)
+    return a.year < b.year;
+  if (a.month != b.month)
+    return a.month < b.month;
+  if (a.day != b.day)
+    return a.day < b.day;
+  if (a.hour != b.hour)
+    return a.hour < b.hour;
+  if (a.minute != b.minute)
+    return a.minute < b.minute;
+  if (a.second != b.second)
+    return a.second < b.second;
+  return a.nanosecond < b.nanosecond;
+}
+
+inline bool endpoint_less(const CivilEndpoint &a, const CivilEndpoint &b) noexcept {
+  return a.mjd < b.mjd || (a.mjd == b.mjd && civil_label_less(a.civil, b.civil));
+}
+
+inline bool endpoint_less_equal(const CivilEndpoint &a, const CivilEndpoint &b) noexcept {
+  return a.mjd < b.mjd || (a.mjd == b.mjd && !civil_label_less(b.civil, a.civil));
+}
+
+inline CivilEndpoint period_start(const CivilPeriod &p) noexcept {
+  return CivilEndpoint{p.mjd.start_mjd, p.start};
+}
+
+inline CivilEndpoint period_end(const CivilPeriod &p) noexcept {
+  return CivilEndpoint{p.mjd.end_mjd, p.end};
+}
+
+inline CivilPeriod civil_period(const CivilEndpoint &start, const CivilEndpoint &end) noexcept {
+  return CivilPeriod{{start.mjd, end.mjd}, start.civil, end.civil};
+}
+
+inline tempoch_status_t period_new(const CivilEndpoint &start, const CivilEndpoint &end,
+                                   CivilPeriod *out) noexcept {
+  if (!endpoint_less_equal(start, end))
+    return TEMPOCH_STATUS_T_INVALID_PERIOD;
+  *out = civil_period(start, end);
+  return TEMPOCH_STATUS_T_OK;
+}
+
+inline bool period_contains(const CivilPeriod &p, const CivilEndpoint &t) noexcept {
+  return endpoint_less_equal(period_start(p), t) && endpoint_less(t, period_end(p));
+}
+
+inline tempoch_status_t period_intersection(const CivilPeriod &a, const CivilPeriod &b,
+                                            CivilPeriod *out) noexcept {
+  const CivilEndpoint start =
+      endpoint_less(period_start(a), period_start(b)) ? period_start(b) : period_start(a);
+  const CivilEndpoint end =
+      endpoint_less(period_end(a), period_end(b)) ? period_end(a) : period_end(b);
+  if (!endpoint_less(start, end))
+    return TEMPOCH_STATUS_T_NO_INTERSECTION;
+  *out = civil_period(start, end);
+  return TEMPOCH_STATUS_T_OK;
+}
+
+inline std::size_t period_union(CivilPeriod a, CivilPeriod b, CivilPeriod out[2]) noexcept {
+  if (endpoint_less(period_start(b), period_start(a)))
+    std::swap(a, b);
+  if (endpoint_less_equal(period_start(b), period_end(a))) {
+    const CivilPeriod &last = endpoint_less(period_end(a), period_end(b)) ? b : a;
+    out[0] = civil_period(period_start(a), period_end(last));
+    return 1;
+  }
+  out[0] = a;
+  out[1] = b;
+  return 2;
+}
+
+// -- Endpoint storage -------------------------------------------------------------
+//
+// `PeriodBounds<T>` chooses what a `Period<T>` stores.  The default is the MJD
+// pair the C ABI takes, so list operations hand periods to tempoch-ffi in
+// place.  `Period<Time<S>>` keeps both endpoints as split seconds instead:
+// `start()` / `end()` are then plain copies with no precision lost to an MJD
+// double, and the MJD view is built only when a list operation needs it.
+// `Period<CivilTime>` stores the MJD pair plus both civil labels, so endpoint
+// access does not decode through `Time<UTC>`.
+
+//
+// Containers (period_set.hpp, period_index.hpp, period_sweep.hpp, parallel.hpp)
+// key a period on its stored endpoints, `endpoint_type`: the MJD, the split
+// seconds of a `Time<S>`, or the `CivilEndpoint` of a `CivilTime`.  They order
+// keys with `endpoint_less` and rebuild periods with `make`, so a `Time<S>`
+// period goes in and out of them without an MJD round trip.
+
+constexpr bool endpoint_less(double a, double b) noexcept { return a < b; }
+constexpr bool endpoint_less_equal(double a, double b) noexcept { return a <= b; }
+
+constexpr bool endpoint_less(const tempoch_time_t &a, const tempoch_time_t &b) noexcept {
+  return split_less(a, b);
+}
+constexpr bool endpoint_less_equal(const tempoch_time_t &a, const tempoch_time_t &b) noexcept {
+  return split_less_equal(a, b);
+}
+
+template <typename K> constexpr const K &endpoint_min(const K &a, const K &b) noexcept {
+  return endpoint_less(b, a) ? b : a;
+}
+template <typename K> constexpr const K &endpoint_max(const K &a, const K &b) noexcept {
+  return endpoint_less(a, b) ? b : a;
+}
+template <typename K> constexpr bool endpoint_equal(const K &a, const K &b) noexcept {
+  return !endpoint_less(a, b) && !endpoint_less(b, a);
+}
+
+template <typename T> struct PeriodBounds {
+  using type = tempoch_period_mjd_t;
+  using endpoint_type = double;
+
+  static double endpoint(const T &time) { return TimeTraits<T>::to_mjd_value(time); }
+  static tempoch_status_t try_endpoint(const T &time, double *out) noexcept {
+    return TimeTraits<T>::try_to_mjd_value(time, out);
+  }
+  static T start(const type &b) { return TimeTraits<T>::from_mjd_value(b.start_mjd); }
+  static T end(const type &b) { return TimeTraits<T>::from_mjd_value(b.end_mjd); }
+  static double days(const type &b) noexcept { return b.end_mjd - b.start_mjd; }
+  static double start_key(const type &b) noexcept { return b.start_mjd; }
+  static double end_key(const type &b) noexcept { return b.end_mjd; }
+  static type make(double start, double end) noexcept { return type{start, end}; }
+  static T time_at(double mjd) { return TimeTraits<T>::from_mjd_value(mjd); }
+  static const tempoch_period_mjd_t &to_mjd(const type &b) noexcept { return b; }
+  static type from_mjd(const tempoch_period_mjd_t &c) noexcept { return c; }
+  static tempoch_status_t try_from_mjd(const tempoch_period_mjd_t &c, type *out) noexcept {
+    *out = c;
+    return TEMPOCH_STATUS_T_OK;
+  }
+};
+
+template <typename S> struct PeriodBounds<Time<S>> {
+  using type = SplitPeriod;
+  using endpoint_type = tempoch_time_t;
+
+  static tempoch_time_t endpoint(const Time<S> &time) noexcept { return time.c_inner(); }
+  static tempoch_status_t try_endpoint(const Time<S> &time, tempoch_time_t *out) noexcept {
+    *out = time.c_inner();
+    return TEMPOCH_STATUS_T_OK;
+  }
+  static Time<S> start(const type &b) noexcept { return Time<S>::from_c(b.start); }
+  static Time<S> end(const type &b) noexcept { return Time<S>::from_c(b.end); }
+  static double days(const type &b) noexcept {
+    return split_difference(b.end, b.start) / kSecondsPerJulianDay;
+  }
+  static tempoch_time_t start_key(const type &b) noexcept { return b.start; }
+  static tempoch_time_t end_key(const type &b) noexcept { return b.end; }
+  static type make(const tempoch_time_t &start, const tempoch_time_t &end) noexcept {
+    return type{start, end};
+  }
+  static Time<S> time_at(const tempoch_time_t &t) noexcept { return Time<S>::from_c(t); }
+  static tempoch_status_t try_to_mjd(const type &b, tempoch_period_mjd_t *out) noexcept {
+    const tempoch_status_t status = try_split_to_mjd<S>(b.start, &out->start_mjd);
+    if (status != TEMPOCH_STATUS_T_OK)
+      return status;
+    return try_split_to_mjd<S>(b.end, &out->end_mjd);
+  }
+  static tempoch_status_t try_from_mjd(const tempoch_period_mjd_t &c, type *out) noexcept {
+    const tempoch_status_t status = try_split_from_mjd<S>(c.start_mjd, &out->start);
+    if (status != TEMPOCH_STATUS_T_OK)
+      return status;
+    return try_split_from_mjd<S>(c.end_mjd, &out->end);
+  }
+  static tempoch_period_mjd_t to_mjd(const type &b) {
+    tempoch_period_mjd_t out{};
+    check_status(try_to_mjd(b, &out), "Period::c_inner");
+    return out;
+  }
+  static type from_mjd(const tempoch_period_mjd_t &c) {
+    type out{};
+    check_status(try_from_mjd(c, &out), "Period::from_c");
+    return out;
+  }
+};
+
+template <> struct PeriodBounds<CivilTime> {
+  using type = CivilPeriod;
+  using endpoint_type = CivilEndpoint;
+
+  static CivilEndpoint endpoint(const CivilTime &time) {
+    return CivilEndpoint{TimeTraits<CivilTime>::to_mjd_value(time), time};
+  }
+  static tempoch_status_t try_endpoint(const CivilTime &time, CivilEndpoint *out) noexcept {
+    out->civil = time;
+    return TimeTraits<CivilTime>::try_to_mjd_value(time, &out->mjd);
+  }
+  static CivilTime start(const type &b) noexcept { return b.start; }
+  static CivilTime end(const type &b) noexcept { return b.end; }
+  static double days(const type &b) noexcept { return b.mjd.end_mjd - b.mjd.start_mjd; }
+  static CivilEndpoint start_key(const type &b) noexcept { return period_start(b); }
+  static CivilEndpoint end_key(const type &b) noexcept { return period_end(b); }
+  static type make(const CivilEndpoint &start, const CivilEndpoint &end) noexcept {
+    return civil_period(start, end);
+  }
+  static CivilTime time_at(const CivilEndpoint &t) noexcept { return t.civil; }
+  static const tempoch_period_mjd_t &to_mjd(const type &b) noexcept { return b.mjd; }
+  static tempoch_status_t try_to_mjd(const type &b, tempoch_period_mjd_t *out) noexcept {
+    *out = b.mjd;
+    return TEMPOCH_STATUS_T_OK;
+  }
+  static tempoch_status_t try_from_mjd(const tempoch_period_mjd_t &c, type *out) noexcept {
+    tempoch_time_t start{};
+    tempoch_time_t end{};
+    using Mjd = format::MJD;
+    tempoch_status_t status = try_decode_time<scale::UTC, Mjd>(c.start_mjd, nullptr, &start);
+    if (status == TEMPOCH_STATUS_T_OK)
+      status = try_decode_time<scale::UTC, Mjd>(c.end_mjd, nullptr, &end);
+    if (status == TEMPOCH_STATUS_T_OK)
+      status = try_time_to_civil(start, nullptr, &out->start);
+    if (status == TEMPOCH_STATUS_T_OK)
+      status = try_time_to_civil(end, nullptr, &out->end);
+    if (status == TEMPOCH_STATUS_T_OK)
+      out->mjd = c;
+    return status;
+  }
+  static type from_mjd(const tempoch_period_mjd_t &c) {
+    type out{};
+    check_status(try_from_mjd(c, &out), "Period::from_c");
+    return out;
+  }
+};
+
+/// Owns a period list allocated by tempoch-ffi and frees it on scope exit.
+struct FfiPeriodBuffer {
+  tempoch_period_mjd_t *ptr = nullptr;
+  std::size_t count = 0;
+
+  FfiPeriodBuffer() = default;
+  FfiPeriodBuffer(const FfiPeriodBuffer &) = delete;
+  FfiPeriodBuffer &operator=(const FfiPeriodBuffer &) = delete;
+  ~FfiPeriodBuffer() {
+    if (ptr != nullptr)
+      TEMPOCH_FFI_CALL(tempoch_period_mjd_free)(ptr, count);
+  }
+
+  /// Copy the list into @p out as `P::from_c(...)` elements.
+  template <typename P, typename OutputIt> OutputIt copy_to(OutputIt out) const {
+    for (std::size_t i = 0; i < count; ++i)
+      *out++ = P::from_c(ptr[i]);
+    return out;
+  }
+
+  /// `copy_to` that stops at, and reports, the first element `P` cannot represent.
+  template <typename P, typename OutputIt>
+  Result<OutputIt> checked_copy_to(OutputIt out, const char *operation) const {
+    for (std::size_t i = 0; i < count; ++i) {
+      Result<P> period = P::checked_from_c(ptr[i]);
+      if (!period)
+        return Error{period.status(), operation};
+      *out++ = *period;
+    }
+    return out;
+  }
+};
+
+/// A span of periods as the `tempoch_period_mjd_t` array the C ABI takes:
+/// the periods themselves when they store MJD pairs, otherwise a converted copy.
+///
+/// A conversion failure does not throw; it stops the copy and is reported by
+/// `status()`, which callers check before handing `data()` to tempoch-ffi.
+template <typename T> class RawPeriodView {
+public:
+  explicit RawPeriodView(span<const Period<T>> periods) : size_(periods.size()) {
+    if constexpr (Period<T>::stores_mjd) {
+      static_assert(sizeof(Period<T>) == sizeof(tempoch_period_mjd_t) &&
+                        std::is_standard_layout_v<Period<T>>,
+                    "Period<T> must stay layout-compatible with tempoch_period_mjd_t");
+      data_ = periods.empty() ? nullptr : &periods[0].c_inner();
+    } else {
+      owned_.resize(size_);
+      for (std::size_t i = 0; i < size_ && status_ == TEMPOCH_STATUS_T_OK; ++i)
+        status_ = PeriodBounds<T>::try_to_mjd(periods[i].storage(), &owned_[i]);
+      data_ = owned_.data();
+    }
+  }
+  RawPeriodView(const RawPeriodView &) = delete;
+  RawPeriodView &operator=(const RawPeriodView &) = delete;
+
+  const tempoch_period_mjd_t *data() const noexcept { return data_; }
+  std::size_t size() const noexcept { return size_; }
+  /// `OK`, or the first endpoint that could not be expressed as an MJD.
+  tempoch_status_t status() const noexcept { return status_; }
+
+private:
+  const tempoch_period_mjd_t *data_ = nullptr;
+  std::size_t size_ = 0;
+  tempoch_status_t status_ = TEMPOCH_STATUS_T_OK;
+  std::vector<tempoch_period_mjd_t> owned_;
+};
+
 } // namespace detail
 
 template <typename T = ModifiedJulianDate<scale::TT>> class Period {
-  tempoch_period_mjd_t m_inner;
+public:
+  /// What the period stores: `tempoch_period_mjd_t`, `detail::SplitPeriod` for `Time<S>`, or
+  /// `detail::CivilPeriod` for `CivilTime`.
+  using storage_type = typename detail::PeriodBounds<T>::type;
+  static constexpr bool stores_mjd = std::is_same_v<storage_type, tempoch_period_mjd_t>;
+  using time_type = T;
+
+private:
+  using Bounds = detail::PeriodBounds<T>;
 
-  explicit Period(const tempoch_period_mjd_t &inner) : m_inner(inner) {}
+  storage_type m_inner{};
+
+  explicit Period(const storage_type &inner) : m_inner(inner) {}
 
 public:
   /// Construct a half-open interval [start, end).
@@ -100,15 +593,42 @@ public:
   /// The period is half-open: @p start is included, @p end is excluded.
   /// @throws InvalidPeriodError if start > end.
   Period(const T &start, const T &end) {
-    check_status(tempoch_period_mjd_new(TimeTraits<T>::to_mjd_value(start),
-                                        TimeTraits<T>::to_mjd_value(end), &m_inner),
+    check_status(detail::period_new(Bounds::endpoint(start), Bounds::endpoint(end), &m_inner),
                  "Period::Period");
   }
 
-  static Period from_c(const tempoch_period_mjd_t &c) { return Period(c); }
+  /// Wrap an MJD pair produced by tempoch-ffi.
+  static Period from_c(const tempoch_period_mjd_t &c) { return Period(Bounds::from_mjd(c)); }
+
+  /// Wrap endpoints already in storage form (no validation or FFI call).
+  static Period from_storage(const storage_type &inner) noexcept { return Period(inner); }
+
+  /// Non-throwing `from_c`; reports the endpoint conversion failure.
+  static Result<Period> checked_from_c(const tempoch_period_mjd_t &c) noexcept {
+    storage_type inner{};
+    const tempoch_status_t status = Bounds::try_from_mjd(c, &inner);
+    if (status != TEMPOCH_STATUS_T_OK)
+      return Error{status, "Period::from_c"};
+    return Period(inner);
+  }
+
+  /// Non-throwing constructor; reports `INVALID_PERIOD` or the endpoint conversion failure.
+  static Result<Period> checked_new(const T &start, const T &end) noexcept {
+    decltype(Bounds::endpoint(start)) start_raw{};
+    decltype(Bounds::endpoint(end)) end_raw{};
+    tempoch_status_t status = Bounds::try_endpoint(start, &start_raw);
+    if (status == TEMPOCH_STATUS_T_OK)
+      status = Bounds::try_endpoint(end, &end_raw);
+    storage_type inner{};
+    if (status == TEMPOCH_STATUS_T_OK)
+      status = detail::period_new(start_raw, end_raw, &inner);
+    if (status != TEMPOCH_STATUS_T_OK)
+      return Error{status, "Period::Period"};
+    return Period(inner);
+  }
 
-  T start() const { return TimeTraits<T>::from_mjd_value(m_inner.start_mjd); }
-  T end() const { return TimeTraits<T>::from_mjd_value(m_inner.end_mjd); }
+  T start() const { return Bounds::start(m_inner); }
+  T end() const { return Bounds::end(m_inner); }
 
   template <typename Target> auto to() const {
     auto converted_start = detail::convert_period_endpoint<Target>(start());
@@ -140,8 +660,7 @@ public:
 
   template <typename TargetType = qtty::DayTag>
   qtty::Quantity<typename qtty::ExtractTag<TargetType>::type> duration() const {
-    auto qty = tempoch_period_mjd_duration_qty(m_inner);
-    return qtty::Quantity<qtty::DayTag>(qty.value).template to<TargetType>();
+    return qtty::Quantity<qtty::DayTag>(Bounds::days(m_inner)).template to<TargetType>();
   }
 
   /// Returns the length of the period (primary name; `duration()` is a backward-compat alias).
@@ -151,46 +670,65 @@ public:
   }
 
   Period intersection(const Period &other) const {
-    tempoch_period_mjd_t out{};
-    check_status(tempoch_period_mjd_intersection(m_inner, other.m_inner, &out),
+    storage_type out{};
+    check_status(detail::period_intersection(m_inner, other.m_inner, &out),
                  "Period::intersection");
-    return from_c(out);
+    return Period(out);
+  }
+
+  /// Non-throwing `intersection`; disjoint periods report `NO_INTERSECTION`.
+  Result<Period> checked_intersection(const Period &other) const noexcept {
+    storage_type out{};
+    const tempoch_status_t status = detail::period_intersection(m_inner, other.m_inner, &out);
+    if (status != TEMPOCH_STATUS_T_OK)
+      return Error{status, "Period::intersection"};
+    return Period(out);
   }
 
   bool contains(const T &point) const noexcept {
-    return tempoch_period_mjd_contains(m_inner, TimeTraits<T>::to_mjd_value(point));
+    return detail::period_contains(m_inner, Bounds::endpoint(point));
   }
 
   std::vector<Period<T>> union_with(const Period<T> &other) const {
-    tempoch_period_mjd_t buf[2];
-    std::size_t count = 0;
-    check_status(tempoch_period_mjd_union(m_inner, other.m_inner, buf, &count),
-                 "Period::union_with");
+    storage_type buf[2];
+    const std::size_t count = detail::period_union(m_inner, other.m_inner, buf);
     std::vector<Period<T>> result;
     result.reserve(count);
     for (std::size_t i = 0; i < count; ++i)
-      result.push_back(from_c(buf[i]));
+      result.push_back(Period(buf[i]));
     return result;
   }
 
-  std::vector<Period<T>> complement_of(const std::vector<Period<T>> &others) const {
-    std::vector<tempoch_period_mjd_t> raw;
-    raw.reserve(others.size());
-    for (const auto &p : others)
-      raw.push_back(p.c_inner());
-    tempoch_period_mjd_t *out = nullptr;
-    std::size_t n = 0;
-    check_status(tempoch_period_list_complement(m_inner, raw.data(), raw.size(), &out, &n),
+  /// Gaps of the sorted, non-overlapping @p others inside this period.
+  template <typename OutputIt>
+  OutputIt complement_of(span<const Period<T>> others, OutputIt out) const {
+    const detail::RawPeriodView<T> raw(others);
+    check_status(raw.status(), "Period::complement_of");
+    detail::FfiPeriodBuffer buf;
+    check_status(TEMPOCH_FFI_CALL(tempoch_period_list_complement)(c_inner(), raw.data(),
+                                                                  raw.size(), &buf.ptr, &buf.count),
                  "Period::complement_of");
+    return buf.template copy_to<Period<T>>(out);
+  }
+
+  std::vector<Period<T>> complement_of(const std::vector<Period<T>> &others) const {
     std::vector<Period<T>> result;
-    result.reserve(n);
-    for (std::size_t i = 0; i < n; ++i)
-      result.push_back(from_c(out[i]));
-    tempoch_period_mjd_free(out, n);
+    result.reserve(others.size() + 1);
+    complement_of(span<const Period<T>>(others), std::back_inserter(result));
     return result;
   }
 
-  const tempoch_period_mjd_t &c_inner() const noexcept { return m_inner; }
+  /// The MJD pair the C ABI takes.
+  ///
+  /// A reference to the stored pair, except for `Time<S>` periods, which convert
+  /// their split endpoints on each call and return the pair by value.
+  std::conditional_t<std::is_same_v<storage_type, detail::SplitPeriod>, tempoch_period_mjd_t,
+                     const tempoch_period_mjd_t &>
+  c_inner() const {
+    return Bounds::to_mjd(m_inner);
+  }
+
+  const storage_type &storage() const noexcept { return m_inner; }
 };
 
 template <typename T> Period(T, T) -> Period<T>;
@@ -198,64 +736,180 @@ template <typename T> Period(T, T) -> Period<T>;
 using TTMjdPeriod = Period<ModifiedJulianDate<scale::TT>>;
 using UTCPeriod = Period<CivilTime>;
 
-namespace detail {
+// -- List operations ------------------------------------------------------------
+//
+// A `Period<T>` that stores an MJD pair is a `tempoch_period_mjd_t` and nothing
+// else, so a contiguous run of them is handed to tempoch-ffi in place (other
+// storage is converted once per call).  The span overloads write their
+// result through an output iterator (a caller buffer's `begin()`, a
+// `back_inserter`, ...); over MJD storage they make no C++ heap allocation,
+// and the only copy is out of the buffer tempoch-ffi returns, which is freed
+// before they return.
+//
+// Output bounds, for sizing caller buffers: intersect ≤ |a| + |b|,
+// union ≤ |a| + |b|, normalize ≤ |periods|, complement ≤ |others| + 1.
+
+template <typename T> inline void validate_periods(span<const Period<T>> periods) {
+  const detail::RawPeriodView<T> raw(periods);
+  check_status(raw.status(), "validate_periods");
+  check_status(TEMPOCH_FFI_CALL(tempoch_period_list_validate)(raw.data(), raw.size()),
+               "validate_periods");
+}
+
+template <typename T> inline void validate_periods(const std::vector<Period<T>> &periods) {
+  validate_periods(span<const Period<T>>(periods));
+}
+
+template <typename T, typename OutputIt>
+inline OutputIt intersect_periods(span<const Period<T>> a, span<const Period<T>> b, OutputIt out) {
+  const detail::RawPeriodView<T> raw_a(a);
+  const detail::RawPeriodView<T> raw_b(b);
+  check_status(raw_a.status(), "intersect_periods");
+  check_status(raw_b.status(), "intersect_periods");
+  detail::FfiPeriodBuffer buf;
+  check_status(TEMPOCH_FFI_CALL(tempoch_period_list_intersect)(raw_a.data(), raw_a.size(),
+                                                               raw_b.data(), raw_b.size(),
+                                                               &buf.ptr, &buf.count),
+               "intersect_periods");
+  return buf.template copy_to<Period<T>>(out);
+}
 
 template <typename T>
-inline std::vector<tempoch_period_mjd_t> to_raw(const std::vector<Period<T>> &periods) {
-  std::vector<tempoch_period_mjd_t> raw;
-  raw.reserve(periods.size());
-  for (const auto &p : periods)
-    raw.push_back(p.c_inner());
-  return raw;
+inline std::vector<Period<T>> intersect_periods(const std::vector<Period<T>> &a,
+                                                const std::vector<Period<T>> &b) {
+  std::vector<Period<T>> result;
+  result.reserve(std::min(a.size(), b.size()));
+  intersect_periods(span<const Period<T>>(a), span<const Period<T>>(b),
+                    std::back_inserter(result));
+  return result;
+}
+
+template <typename T, typename OutputIt>
+inline OutputIt union_periods(span<const Period<T>> a, span<const Period<T>> b, OutputIt out) {
+  const detail::RawPeriodView<T> raw_a(a);
+  const detail::RawPeriodView<T> raw_b(b);
+  check_status(raw_a.status(), "union_periods");
+  check_status(raw_b.status(), "union_periods");
+  detail::FfiPeriodBuffer buf;
+  check_status(TEMPOCH_FFI_CALL(tempoch_period_list_union)(raw_a.data(), raw_a.size(),
+                                                           raw_b.data(), raw_b.size(),
+                                                           &buf.ptr, &buf.count),
+               "union_periods");
+  return buf.template copy_to<Period<T>>(out);
 }
 
 template <typename T>
-inline std::vector<Period<T>> from_alloc(tempoch_period_mjd_t *ptr, std::size_t count) {
+inline std::vector<Period<T>> union_periods(const std::vector<Period<T>> &a,
+                                            const std::vector<Period<T>> &b) {
   std::vector<Period<T>> result;
-  result.reserve(count);
-  for (std::size_t i = 0; i < count; ++i)
-    result.push_back(Period<T>::from_c(ptr[i]));
-  tempoch_period_mjd_free(ptr, count);
+  result.reserve(a.size() + b.size());
+  union_periods(span<const Period<T>>(a), span<const Period<T>>(b), std::back_inserter(result));
   return result;
 }
 
-} // namespace detail
+template <typename T, typename OutputIt>
+inline OutputIt normalize_periods(span<const Period<T>> periods, OutputIt out) {
+  const detail::RawPeriodView<T> raw(periods);
+  check_status(raw.status(), "normalize_periods");
+  detail::FfiPeriodBuffer buf;
+  check_status(TEMPOCH_FFI_CALL(tempoch_period_list_normalize)(raw.data(), raw.size(), &buf.ptr,
+                                                               &buf.count),
+               "normalize_periods");
+  return buf.template copy_to<Period<T>>(out);
+}
 
-template <typename T> inline void validate_periods(const std::vector<Period<T>> &periods) {
-  auto raw = detail::to_raw(periods);
-  check_status(tempoch_period_list_validate(raw.data(), raw.size()), "validate_periods");
+template <typename T>
+inline std::vector<Period<T>> normalize_periods(const std::vector<Period<T>> &periods) {
+  std::vector<Period<T>> result;
+  result.reserve(periods.size());
+  normalize_periods(span<const Period<T>>(periods), std::back_inserter(result));
+  return result;
+}
+
+// -- Non-throwing list operations ---------------------------------------------
+
+template <typename T> inline Result<void> checked_validate_periods(span<const Period<T>> periods) {
+  const detail::RawPeriodView<T> raw(periods);
+  if (raw.status() != TEMPOCH_STATUS_T_OK)
+    return Error{raw.status(), "validate_periods"};
+  return Result<void>::from_status(
+      TEMPOCH_FFI_CALL(tempoch_period_list_validate)(raw.data(), raw.size()), "validate_periods");
 }
 
 template <typename T>
-inline std::vector<Period<T>> intersect_periods(const std::vector<Period<T>> &a,
-                                                const std::vector<Period<T>> &b) {
-  auto ra = detail::to_raw(a), rb = detail::to_raw(b);
-  tempoch_period_mjd_t *out = nullptr;
-  std::size_t n = 0;
-  check_status(tempoch_period_list_intersect(ra.data(), ra.size(), rb.data(), rb.size(), &out, &n),
-               "intersect_periods");
-  return detail::from_alloc<T>(out, n);
+inline Result<void> checked_validate_periods(const std::vector<Period<T>> &periods) {
+  return checked_validate_periods(span<const Period<T>>(periods));
+}
+
+template <typename T, typename OutputIt>
+inline Result<OutputIt> checked_intersect_periods(span<const Period<T>> a, span<const Period<T>> b,
+                                                  OutputIt out) {
+  const detail::RawPeriodView<T> raw_a(a);
+  const detail::RawPeriodView<T> raw_b(b);
+  if (raw_a.status() != TEMPOCH_STATUS_T_OK || raw_b.status() != TEMPOCH_STATUS_T_OK)
+    return Error{raw_a.status() != TEMPOCH_STATUS_T_OK ? raw_a.status() : raw_b.status(),
+                 "intersect_periods"};
+  detail::FfiPeriodBuffer buf;
+  const tempoch_status_t status = TEMPOCH_FFI_CALL(tempoch_period_list_intersect)(
+      raw_a.data(), raw_a.size(), raw_b.data(), raw_b.size(), &buf.ptr, &buf.count);
+  if (status != TEMPOCH_STATUS_T_OK)
+    return Error{status, "intersect_periods"};
+  return buf.template checked_copy_to<Period<T>>(out, "intersect_periods");
 }
 
 template <typename T>
-inline std::vector<Period<T>> union_periods(const std::vector<Period<T>> &a,
-                                            const std::vector<Period<T>> &b) {
-  auto ra = detail::to_raw(a), rb = detail::to_raw(b);
-  tempoch_period_mjd_t *out = nullptr;
-  std::size_t n = 0;
-  check_status(tempoch_period_list_union(ra.data(), ra.size(), rb.data(), rb.size(), &out, &n),
-               "union_periods");
-  return detail::from_alloc<T>(out, n);
+inline Result<std::vector<Period<T>>> checked_intersect_periods(const std::vector<Period<T>> &a,
+                                                                const std::vector<Period<T>> &b) {
+  std::vector<Period<T>> result;
+  return checked_intersect_periods(span<const Period<T>>(a), span<const Period<T>>(b),
+                                   std::back_inserter(result))
+      .map([&](const auto &) { return std::move(result); });
+}
+
+template <typename T, typename OutputIt>
+inline Result<OutputIt> checked_union_periods(span<const Period<T>> a, span<const Period<T>> b,
+                                              OutputIt out) {
+  const detail::RawPeriodView<T> raw_a(a);
+  const detail::RawPeriodView<T> raw_b(b);
+  if (raw_a.status() != TEMPOCH_STATUS_T_OK || raw_b.status() != TEMPOCH_STATUS_T_OK)
+    return Error{raw_a.status() != TEMPOCH_STATUS_T_OK ? raw_a.status() : raw_b.status(),
+                 "union_periods"};
+  detail::FfiPeriodBuffer buf;
+  const tempoch_status_t status = TEMPOCH_FFI_CALL(tempoch_period_list_union)(
+      raw_a.data(), raw_a.size(), raw_b.data(), raw_b.size(), &buf.ptr, &buf.count);
+  if (status != TEMPOCH_STATUS_T_OK)
+    return Error{status, "union_periods"};
+  return buf.template checked_copy_to<Period<T>>(out, "union_periods");
 }
 
 template <typename T>
-inline std::vector<Period<T>> normalize_periods(const std::vector<Period<T>> &periods) {
-  auto raw = detail::to_raw(periods);
-  tempoch_period_mjd_t *out = nullptr;
-  std::size_t n = 0;
-  check_status(tempoch_period_list_normalize(raw.data(), raw.size(), &out, &n),
-               "normalize_periods");
-  return detail::from_alloc<T>(out, n);
+inline Result<std::vector<Period<T>>> checked_union_periods(const std::vector<Period<T>> &a,
+                                                            const std::vector<Period<T>> &b) {
+  std::vector<Period<T>> result;
+  return checked_union_periods(span<const Period<T>>(a), span<const Period<T>>(b),
+                               std::back_inserter(result))
+      .map([&](const auto &) { return std::move(result); });
+}
+
+template <typename T, typename OutputIt>
+inline Result<OutputIt> checked_normalize_periods(span<const Period<T>> periods, OutputIt out) {
+  const detail::RawPeriodView<T> raw(periods);
+  if (raw.status() != TEMPOCH_STATUS_T_OK)
+    return Error{raw.status(), "normalize_periods"};
+  detail::FfiPeriodBuffer buf;
+  const tempoch_status_t status = TEMPOCH_FFI_CALL(tempoch_period_list_normalize)(
+      raw.data(), raw.size(), &buf.ptr, &buf.count);
+  if (status != TEMPOCH_STATUS_T_OK)
+    return Error{status, "normalize_periods"};
+  return buf.template checked_copy_to<Period<T>>(out, "normalize_periods");
+}
+
+template <typename T>
+inline Result<std::vector<Period<T>>>
+checked_normalize_periods(const std::vector<Period<T>> &periods) {
+  std::vector<Period<T>> result;
+  return checked_normalize_periods(span<const Period<T>>(periods), std::back_inserter(result))
+      .map([&](const auto &) { return std::move(result); });
 }
 
 template <typename T> inline std::ostream &operator<<(std::ostream &os, const Period<T> &period) {
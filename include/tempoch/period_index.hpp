@@ -0,0 +1,181 @@
+#pragma once
+
+/**
+ * @file period_index.hpp
+ * @brief Static interval index over overlapping periods.
+ *
+ * `PeriodIndex<T>` keeps a collection of possibly overlapping `[start, end)`
+ * periods distinct and answers "which periods contain t" and "which periods
+ * overlap [a, b)" in O(log n + k).  It is an implicit augmented interval tree:
+ * the periods are sorted by start once, and every node of the balanced tree
+ * laid over that array records the largest end in its subtree, so whole
+ * subtrees that end before the query are skipped.
+ *
+ * @code
+ * using Mjd = tempoch::ModifiedJulianDate<tempoch::scale::TT>;
+ * const tempoch::PeriodIndex<Mjd> index(exposures);   // O(n log n), once
+ * for (std::size_t i : index.containing(Mjd(60123.25)))
+ *   use(exposures[i]);                                 // indices into `exposures`
+ * @endcode
+ *
+ * Results are indices into the list the index was built from, in order of
+ * increasing start.  Empty periods (`start == end`) contain no instant and are
+ * not indexed.  Use `PeriodSet<T>` instead when overlapping periods may be
+ * merged.
+ */
+
+#include "period.hpp"
+#include "result.hpp"
+#include "span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace tempoch {
+
+template <typename T = ModifiedJulianDate<scale::TT>> class PeriodIndex {
+public:
+  using value_type = Period<T>;
+  using size_type = std::size_t;
+  /// One stored endpoint; `double` (an MJD) unless `Period<T>::stores_mjd` is false.
+  using endpoint_type = typename detail::PeriodBounds<T>::endpoint_type;
+
+  /// The empty index.
+  PeriodIndex() = default;
+
+  /// Index @p periods; query results refer to positions in this list.
+  /// @throws InvalidPeriodError if any period has start > end.
+  explicit PeriodIndex(const std::vector<Period<T>> &periods) {
+    check_status(build(span<const Period<T>>(periods)), "PeriodIndex::PeriodIndex");
+  }
+
+  /// Non-throwing constructor; reports `INVALID_PERIOD`.  Makes no FFI call.
+  static Result<PeriodIndex> checked_new(span<const Period<T>> periods) {
+    PeriodIndex index;
+    const tempoch_status_t status = index.build(periods);
+    if (status != TEMPOCH_STATUS_T_OK)
+      return Error{status, "PeriodIndex::PeriodIndex"};
+    return index;
+  }
+
+  /// Number of indexed (non-empty) periods.
+  size_type size() const noexcept { return starts_.size(); }
+  bool empty() const noexcept { return starts_.empty(); }
+
+  // -- Stabbing queries -----------------------------------------------------
+
+  /// Call `fn(index)` for every period with `start <= point < end`.
+  template <typename Fn> void for_each_containing(const T &point, Fn &&fn) const {
+    const endpoint_type t = Bounds::endpoint(point);
+    const auto start_ok = [&t](const endpoint_type &start) {
+      return detail::endpoint_less_equal(start, t);
+    };
+    visit(0, size(), t, start_ok, fn);
+  }
+
+  std::vector<size_type> containing(const T &point) const {
+    std::vector<size_type> out;
+    for_each_containing(point, [&](size_type i) { out.push_back(i); });
+    return out;
+  }
+
+  // -- Range-overlap queries ------------------------------------------------
+
+  /// Call `fn(index)` for every period sharing at least one instant with @p range.
+  template <typename Fn> void for_each_overlapping(const Period<T> &range, Fn &&fn) const {
+    const endpoint_type lo = Bounds::start_key(range.storage());
+    const endpoint_type hi = Bounds::end_key(range.storage());
+    if (!detail::endpoint_less(lo, hi))
+      return;
+    const auto start_ok = [&hi](const endpoint_type &start) {
+      return detail::endpoint_less(start, hi);
+    };
+    visit(0, size(), lo, start_ok, fn);
+  }
+
+  std::vector<size_type> overlapping(const Period<T> &range) const {
+    std::vector<size_type> out;
+    for_each_overlapping(range, [&](size_type i) { out.push_back(i); });
+    return out;
+  }
+
+private:
+  using Bounds = detail::PeriodBounds<T>;
+
+  // Parallel arrays in start order.  `max_end_[m]` is the largest end in the
+  // subtree rooted at `m`, where the subtree of [lo, hi) is rooted at its midpoint.
+  std::vector<endpoint_type> starts_;
+  std::vector<endpoint_type> ends_;
+  std::vector<endpoint_type> max_end_;
+  std::vector<size_type> ids_;
+
+  /// Report every period in [lo, hi) with `end > min_end` whose start passes
+  /// @p start_ok.  `start_ok` must be monotone (true, then false) in start order.
+  template <typename StartOk, typename Fn>
+  void visit(size_type lo, size_type hi, const endpoint_type &min_end, const StartOk &start_ok,
+             Fn &fn) const {
+    while (lo < hi) {
+      const size_type mid = lo + (hi - lo) / 2;
+      if (!detail::endpoint_less(min_end, max_end_[mid]))
+        return;
+      visit(lo, mid, min_end, start_ok, fn);
+      if (!start_ok(starts_[mid]))
+        return;
+      if (detail::endpoint_less(min_end, ends_[mid]))
+        fn(ids_[mid]);
+      lo = mid + 1;
+    }
+  }
+
+  endpoint_type annotate(size_type lo, size_type hi) {
+    const size_type mid = lo + (hi - lo) / 2;
+    endpoint_type m = ends_[mid];
+    if (lo < mid)
+      m = detail::endpoint_max(m, annotate(lo, mid));
+    if (mid + 1 < hi)
+      m = detail::endpoint_max(m, annotate(mid + 1, hi));
+    max_end_[mid] = m;
+    return m;
+  }
+
+  tempoch_status_t build(span<const Period<T>> periods) {
+    struct Entry {
+      endpoint_type start;
+      endpoint_type end;
+      size_type id;
+    };
+    std::vector<Entry> entries;
+    entries.reserve(periods.size());
+    for (size_type i = 0; i < periods.size(); ++i) {
+      const endpoint_type s = Bounds::start_key(periods[i].storage());
+      const endpoint_type e = Bounds::end_key(periods[i].storage());
+      if (!detail::endpoint_less_equal(s, e))
+        return TEMPOCH_STATUS_T_INVALID_PERIOD;
+      if (detail::endpoint_less(s, e))
+        entries.push_back({s, e, i});
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+      if (detail::endpoint_less(a.start, b.start))
+        return true;
+      return !detail::endpoint_less(b.start, a.start) && a.id < b.id;
+    });
+
+    starts_.resize(entries.size());
+    ends_.resize(entries.size());
+    ids_.resize(entries.size());
+    max_end_.resize(entries.size());
+    for (size_type i = 0; i < entries.size(); ++i) {
+      starts_[i] = entries[i].start;
+      ends_[i] = entries[i].end;
+      ids_[i] = entries[i].id;
+    }
+    if (!entries.empty())
+      annotate(0, entries.size());
+    return TEMPOCH_STATUS_T_OK;
+  }
+};
+
+template <typename T> PeriodIndex(std::vector<Period<T>>) -> PeriodIndex<T>;
+
+} // namespace tempoch
@@ -0,0 +1,319 @@
+#pragma once
+
+/**
+ * @file period_set.hpp
+ * @brief Normalized set of half-open periods with logarithmic point queries.
+ *
+ * `PeriodSet<T>` owns a sorted list of disjoint, non-touching `[start, end)`
+ * periods, kept as two parallel endpoint arrays (`starts()` / `ends()`) in
+ * the form `Period<T>` stores them: MJDs, split seconds for `Time<S>`, or MJD
+ * plus civil label for `CivilTime`.  The invariant is established once on
+ * construction, so point queries are a binary search and set algebra between
+ * two sets is a single linear merge with no re-validation.
+ *
+ * @code
+ * using Mjd = tempoch::ModifiedJulianDate<tempoch::scale::TT>;
+ * tempoch::PeriodSet<Mjd> visible(windows);          // sorts and merges once
+ * if (visible.contains(Mjd(60123.25))) { ... }       // O(log n)
+ * auto usable = visible & available;                 // O(n + m)
+ * @endcode
+ *
+ * Empty periods (`start == end`) contain no instant and are dropped.
+ */
+
+#include "period.hpp"
+#include "result.hpp"
+#include "span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace tempoch {
+
+template <typename T = ModifiedJulianDate<scale::TT>> class PeriodSet {
+public:
+  using value_type = Period<T>;
+  using size_type = std::size_t;
+  /// One stored endpoint; `double` (an MJD) unless `Period<T>::stores_mjd` is false.
+  using endpoint_type = typename detail::PeriodBounds<T>::endpoint_type;
+
+  /// The empty set.
+  PeriodSet() = default;
+
+  /// Sort and merge @p periods into a set.
+  /// @throws InvalidPeriodError if any period has start > end.
+  explicit PeriodSet(const std::vector<Period<T>> &periods) {
+    check_status(assign(span<const Period<T>>(periods)), "PeriodSet::PeriodSet");
+  }
+
+  /// Non-throwing constructor; reports `INVALID_PERIOD`.  Makes no FFI call.
+  static Result<PeriodSet> checked_new(span<const Period<T>> periods) {
+    PeriodSet set;
+    const tempoch_status_t status = set.assign(periods);
+    if (status != TEMPOCH_STATUS_T_OK)
+      return Error{status, "PeriodSet::PeriodSet"};
+    return set;
+  }
+
+  /// Adopt an already sorted, non-overlapping list without re-sorting it.
+  ///
+  /// Touching neighbours are merged.
+  /// @throws PeriodListUnsortedError / PeriodListOverlappingError like `validate_periods`.
+  static PeriodSet from_sorted(span<const Period<T>> periods) {
+    PeriodSet set;
+    check_status(set.assign_sorted(periods), "PeriodSet::from_sorted");
+    return set;
+  }
+
+  size_type size() const noexcept { return starts_.size(); }
+  bool empty() const noexcept { return starts_.empty(); }
+
+  /// The i-th period in start order.
+  Period<T> operator[](size_type i) const noexcept {
+    return Period<T>::from_storage(Bounds::make(starts_[i], ends_[i]));
+  }
+
+  /// Starts in increasing order.
+  span<const endpoint_type> starts() const noexcept { return span<const endpoint_type>(starts_); }
+  /// Ends, parallel to `starts()`.
+  span<const endpoint_type> ends() const noexcept { return span<const endpoint_type>(ends_); }
+
+  std::vector<Period<T>> to_vector() const {
+    std::vector<Period<T>> out;
+    out.reserve(size());
+    for (size_type i = 0; i < size(); ++i)
+      out.push_back((*this)[i]);
+    return out;
+  }
+
+  /// Total covered length.
+  template <typename TargetType = qtty::DayTag>
+  qtty::Quantity<typename qtty::ExtractTag<TargetType>::type> total_duration() const {
+    double days = 0.0;
+    for (size_type i = 0; i < size(); ++i)
+      days += Bounds::days(Bounds::make(starts_[i], ends_[i]));
+    return qtty::Quantity<qtty::DayTag>(days).template to<TargetType>();
+  }
+
+  // -- Point queries (O(log n)) ---------------------------------------------
+
+  bool contains(const T &point) const { return find(Bounds::endpoint(point)) < size(); }
+
+  /// The period containing @p point, if any.
+  std::optional<Period<T>> covering_period(const T &point) const {
+    const size_type i = find(Bounds::endpoint(point));
+    if (i == size())
+      return std::nullopt;
+    return (*this)[i];
+  }
+
+  /// The first period start strictly after @p point, if any.
+  std::optional<T> next_start_after(const T &point) const {
+    const size_type i = count_starts_at_or_before(Bounds::endpoint(point));
+    if (i == size())
+      return std::nullopt;
+    return Bounds::time_at(starts_[i]);
+  }
+
+  // -- Set algebra (O(n + m)) -----------------------------------------------
+
+  /// Add one period, merging it with every period it overlaps or touches (O(n) worst case).
+  void insert(const Period<T> &period) {
+    const endpoint_type s = Bounds::start_key(period.storage());
+    const endpoint_type e = Bounds::end_key(period.storage());
+    if (!detail::endpoint_less(s, e))
+      return;
+    // [first, last) are the periods overlapping or touching [s, e].
+    const auto first = static_cast<size_type>(
+        std::lower_bound(ends_.begin(), ends_.end(), s, before) - ends_.begin());
+    const auto last = static_cast<size_type>(
+        std::upper_bound(starts_.begin(), starts_.end(), e, before) - starts_.begin());
+    if (first == last) {
+      starts_.insert(starts_.begin() + first, s);
+      ends_.insert(ends_.begin() + first, e);
+      return;
+    }
+    starts_[first] = detail::endpoint_min(s, starts_[first]);
+    ends_[first] = detail::endpoint_max(e, ends_[last - 1]);
+    starts_.erase(starts_.begin() + first + 1, starts_.begin() + last);
+    ends_.erase(ends_.begin() + first + 1, ends_.begin() + last);
+  }
+
+  friend PeriodSet operator|(const PeriodSet &a, const PeriodSet &b) {
+    PeriodSet out;
+    out.reserve(a.size() + b.size());
+    size_type i = 0, j = 0;
+    while (i < a.size() || j < b.size()) {
+      const bool take_a = j == b.size() ||
+                          (i < a.size() && detail::endpoint_less_equal(a.starts_[i], b.starts_[j]));
+      const endpoint_type s = take_a ? a.starts_[i] : b.starts_[j];
+      const endpoint_type e = take_a ? a.ends_[i++] : b.ends_[j++];
+      out.append_merging(s, e);
+    }
+    return out;
+  }
+
+  friend PeriodSet operator&(const PeriodSet &a, const PeriodSet &b) {
+    PeriodSet out;
+    size_type i = 0, j = 0;
+    while (i < a.size() && j < b.size()) {
+      const endpoint_type s = detail::endpoint_max(a.starts_[i], b.starts_[j]);
+      const endpoint_type e = detail::endpoint_min(a.ends_[i], b.ends_[j]);
+      if (detail::endpoint_less(s, e))
+        out.push_back(s, e);
+      if (detail::endpoint_less(a.ends_[i], b.ends_[j]))
+        ++i;
+      else
+        ++j;
+    }
+    return out;
+  }
+
+  /// Instants of @p a that are not in @p b.
+  friend PeriodSet operator-(const PeriodSet &a, const PeriodSet &b) {
+    PeriodSet out;
+    size_type j = 0;
+    for (size_type i = 0; i < a.size(); ++i) {
+      endpoint_type cursor = a.starts_[i];
+      const endpoint_type end = a.ends_[i];
+      while (j < b.size() && detail::endpoint_less_equal(b.ends_[j], cursor))
+        ++j;
+      for (size_type k = j; k < b.size() && detail::endpoint_less(b.starts_[k], end); ++k) {
+        if (detail::endpoint_less(cursor, b.starts_[k]))
+          out.push_back(cursor, b.starts_[k]);
+        cursor = detail::endpoint_max(cursor, b.ends_[k]);
+      }
+      if (detail::endpoint_less(cursor, end))
+        out.push_back(cursor, end);
+    }
+    return out;
+  }
+
+  PeriodSet &operator|=(const PeriodSet &other) { return *this = *this | other; }
+  PeriodSet &operator&=(const PeriodSet &other) { return *this = *this & other; }
+  PeriodSet &operator-=(const PeriodSet &other) { return *this = *this - other; }
+
+  /// The gaps of this set inside @p window.
+  PeriodSet complement(const Period<T> &window) const {
+    PeriodSet w;
+    w.insert(window);
+    return w - *this;
+  }
+
+  friend bool operator==(const PeriodSet &a, const PeriodSet &b) noexcept {
+    const auto same = [](const endpoint_type &x, const endpoint_type &y) {
+      return detail::endpoint_equal(x, y);
+    };
+    return std::equal(a.starts_.begin(), a.starts_.end(), b.starts_.begin(), b.starts_.end(),
+                      same) &&
+           std::equal(a.ends_.begin(), a.ends_.end(), b.ends_.begin(), b.ends_.end(), same);
+  }
+  friend bool operator!=(const PeriodSet &a, const PeriodSet &b) noexcept { return !(a == b); }
+
+private:
+  using Bounds = detail::PeriodBounds<T>;
+
+  std::vector<endpoint_type> starts_;
+  std::vector<endpoint_type> ends_;
+
+  static bool before(const endpoint_type &a, const endpoint_type &b) noexcept {
+    return detail::endpoint_less(a, b);
+  }
+
+  void reserve(size_type n) {
+    starts_.reserve(n);
+    ends_.reserve(n);
+  }
+
+  void push_back(const endpoint_type &s, const endpoint_type &e) {
+    starts_.push_back(s);
+    ends_.push_back(e);
+  }
+
+  /// Append [s, e) given s >= the last start, merging into the last period when they meet.
+  void append_merging(const endpoint_type &s, const endpoint_type &e) {
+    if (!detail::endpoint_less(s, e))
+      return;
+    if (!ends_.empty() && detail::endpoint_less_equal(s, ends_.back())) {
+      ends_.back() = detail::endpoint_max(ends_.back(), e);
+      return;
+    }
+    push_back(s, e);
+  }
+
+  /// Number of starts <= @p t, i.e. `std::upper_bound` as an index.  Written
+  /// without a data-dependent branch so random probes do not pay a mispredict
+  /// per halving step.
+  size_type count_starts_at_or_before(const endpoint_type &t) const noexcept {
+    size_type n = starts_.size();
+    if (n == 0)
+      return 0;
+    const endpoint_type *base = starts_.data();
+    while (n > 1) {
+      const size_type half = n / 2;
+      base = detail::endpoint_less_equal(base[half], t) ? base + half : base;
+      n -= half;
+    }
+    return static_cast<size_type>(base - starts_.data()) +
+           (detail::endpoint_less_equal(*base, t) ? 1 : 0);
+  }
+
+  /// Index of the period containing @p t, or `size()`.
+  size_type find(const endpoint_type &t) const noexcept {
+    const size_type upper = count_starts_at_or_before(t);
+    if (upper == 0)
+      return size();
+    return detail::endpoint_less(t, ends_[upper - 1]) ? upper - 1 : size();
+  }
+
+  tempoch_status_t assign(span<const Period<T>> periods) {
+    std::vector<size_type> order(periods.size());
+    std::iota(order.begin(), order.end(), size_type{0});
+    for (const auto &p : periods) {
+      if (!detail::endpoint_less_equal(Bounds::start_key(p.storage()),
+                                       Bounds::end_key(p.storage())))
+        return TEMPOCH_STATUS_T_INVALID_PERIOD;
+    }
+    std::sort(order.begin(), order.end(), [&](size_type x, size_type y) {
+      return before(Bounds::start_key(periods[x].storage()),
+                    Bounds::start_key(periods[y].storage()));
+    });
+    starts_.clear();
+    ends_.clear();
+    reserve(periods.size());
+    for (size_type i : order) {
+      const auto &p = periods[i].storage();
+      append_merging(Bounds::start_key(p), Bounds::end_key(p));
+    }
+    return TEMPOCH_STATUS_T_OK;
+  }
+
+  tempoch_status_t assign_sorted(span<const Period<T>> periods) {
+    starts_.clear();
+    ends_.clear();
+    reserve(periods.size());
+    for (size_type i = 0; i < periods.size(); ++i) {
+      const endpoint_type s = Bounds::start_key(periods[i].storage());
+      const endpoint_type e = Bounds::end_key(periods[i].storage());
+      if (!detail::endpoint_less_equal(s, e))
+        return TEMPOCH_STATUS_T_INVALID_PERIOD;
+      if (i > 0) {
+        const auto &prev = periods[i - 1].storage();
+        if (before(s, Bounds::start_key(prev)))
+          return TEMPOCH_STATUS_T_PERIOD_LIST_UNSORTED;
+        if (before(s, Bounds::end_key(prev)))
+          return TEMPOCH_STATUS_T_PERIOD_LIST_OVERLAPPING;
+      }
+      append_merging(s, e);
+    }
+    return TEMPOCH_STATUS_T_OK;
+  }
+};
+
+template <typename T> PeriodSet(std::vector<Period<T>>) -> PeriodSet<T>;
+
+} // namespace tempoch
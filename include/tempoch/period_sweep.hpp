@@ -0,0 +1,349 @@
+#pragma once
+
+/**
+ * @file period_sweep.hpp
+ * @brief Lazy sweep-line union, intersection and difference over sorted period streams.
+ *
+ * `intersect_periods` / `union_periods` need both lists in memory.  A
+ * `PeriodSweep` instead pulls `Period<T>` values from input iterators one at a
+ * time and produces the result on demand, holding one period per input, so it
+ * can run over streams that never fit in memory.
+ *
+ * @code
+ * // `planned` and `observed` yield Period<T> from input iterators, e.g. a file
+ * // reader that decodes one window per increment.
+ * auto gaps = tempoch::sweep_difference(planned.begin(), planned.end(),
+ *                                       observed.begin(), observed.end());
+ * for (const auto &gap : gaps)
+ *   report(gap);
+ * gaps.check();                           // throws if an input was out of order
+ * @endcode
+ *
+ * Each input must be sorted by start with no overlaps, the same contract as
+ * `validate_periods`.  The contract is checked incrementally: on the first
+ * offending period the sweep stops, and `status()` / `check()` report
+ * `INVALID_PERIOD`, `PERIOD_LIST_UNSORTED` or `PERIOD_LIST_OVERLAPPING`.
+ * Empty periods are validated but never produced.
+ */
+
+#include "period.hpp"
+#include "result.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace tempoch {
+
+enum class PeriodSweepOp { Union, Intersection, Difference };
+
+namespace detail {
+
+/// One sorted input: the current non-empty period plus the last one seen, for validation.
+template <typename It> class SortedPeriodCursor {
+  using Bounds = PeriodBounds<typename std::iterator_traits<It>::value_type::time_type>;
+
+public:
+  using endpoint_type = typename Bounds::endpoint_type;
+
+  SortedPeriodCursor(It first, It last) : it_(std::move(first)), last_(std::move(last)) {
+    load();
+  }
+
+  bool done() const noexcept { return done_; }
+  tempoch_status_t status() const noexcept { return status_; }
+  const endpoint_type &start() const noexcept { return start_; }
+  const endpoint_type &end() const noexcept { return end_; }
+
+  void advance() {
+    ++it_;
+    load();
+  }
+
+private:
+  It it_;
+  It last_;
+  endpoint_type start_{};
+  endpoint_type end_{};
+  endpoint_type previous_start_{};
+  endpoint_type previous_end_{};
+  bool seen_ = false;
+  bool done_ = false;
+  tempoch_status_t status_ = TEMPOCH_STATUS_T_OK;
+
+  void load() {
+    for (; it_ != last_; ++it_) {
+      const typename Bounds::type p = (*it_).storage();
+      const endpoint_type s = Bounds::start_key(p);
+      const endpoint_type e = Bounds::end_key(p);
+      if (!endpoint_less_equal(s, e))
+        return fail(TEMPOCH_STATUS_T_INVALID_PERIOD);
+      if (seen_ && endpoint_less(s, previous_start_))
+        return fail(TEMPOCH_STATUS_T_PERIOD_LIST_UNSORTED);
+      if (seen_ && endpoint_less(s, previous_end_))
+        return fail(TEMPOCH_STATUS_T_PERIOD_LIST_OVERLAPPING);
+      previous_start_ = s;
+      previous_end_ = e;
+      seen_ = true;
+      if (endpoint_less(s, e)) {
+        start_ = s;
+        end_ = e;
+        return;
+      }
+    }
+    done_ = true;
+  }
+
+  void fail(tempoch_status_t status) {
+    status_ = status;
+    done_ = true;
+  }
+};
+
+} // namespace detail
+
+/**
+ * @brief Pull-based sweep over sorted period streams.
+ *
+ * Built by `sweep_union`, `sweep_intersection` and `sweep_difference`.  Call
+ * `next()` until it returns `std::nullopt`, or iterate with a range-for; the
+ * iterator is single-pass.
+ */
+template <typename It> class PeriodSweep {
+public:
+  using period_type = typename std::iterator_traits<It>::value_type;
+  using range_type = std::pair<It, It>;
+
+  PeriodSweep(PeriodSweepOp op, std::vector<range_type> inputs) : op_(op) {
+    inputs_.reserve(inputs.size());
+    for (auto &range : inputs)
+      inputs_.emplace_back(std::move(range.first), std::move(range.second));
+  }
+
+  /// The next result period, or `std::nullopt` once the sweep is exhausted or has failed.
+  std::optional<period_type> next() {
+    if (status_ != TEMPOCH_STATUS_T_OK)
+      return std::nullopt;
+    std::optional<period_type> out;
+    switch (op_) {
+    case PeriodSweepOp::Union:
+      out = next_union();
+      break;
+    case PeriodSweepOp::Intersection:
+      out = next_intersection();
+      break;
+    case PeriodSweepOp::Difference:
+      out = next_difference();
+      break;
+    }
+    if (status_ != TEMPOCH_STATUS_T_OK)
+      return std::nullopt;
+    return out;
+  }
+
+  /// `OK`, or the first validation failure met on any input.
+  tempoch_status_t status() const noexcept { return status_; }
+
+  /// @throws the exception `check_status` maps a validation failure to.
+  void check() const { check_status(status_, operation_name()); }
+
+  /// Drain the remaining periods into @p out.
+  /// @throws PeriodListUnsortedError etc. if an input breaks the sort contract.
+  template <typename OutputIt> OutputIt copy_to(OutputIt out) {
+    while (auto p = next())
+      *out++ = *p;
+    check();
+    return out;
+  }
+
+  class iterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = period_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const period_type *;
+    using reference = const period_type &;
+
+    iterator() = default;
+    explicit iterator(PeriodSweep *sweep) : sweep_(sweep) { ++*this; }
+
+    reference operator*() const { return *value_; }
+    pointer operator->() const { return &*value_; }
+    iterator &operator++() {
+      value_ = sweep_->next();
+      if (!value_)
+        sweep_ = nullptr;
+      return *this;
+    }
+    friend bool operator==(const iterator &a, const iterator &b) noexcept {
+      return a.sweep_ == b.sweep_;
+    }
+    friend bool operator!=(const iterator &a, const iterator &b) noexcept { return !(a == b); }
+
+  private:
+    PeriodSweep *sweep_ = nullptr;
+    std::optional<period_type> value_;
+  };
+
+  iterator begin() { return iterator(this); }
+  iterator end() { return iterator(); }
+
+private:
+  using Cursor = detail::SortedPeriodCursor<It>;
+  using Bounds = detail::PeriodBounds<typename period_type::time_type>;
+  using endpoint_type = typename Cursor::endpoint_type;
+
+  PeriodSweepOp op_;
+  std::vector<Cursor> inputs_;
+  tempoch_status_t status_ = TEMPOCH_STATUS_T_OK;
+  // Difference: the unconsumed tail [cut_, minuend end) of the current minuend period.
+  bool cutting_ = false;
+  endpoint_type cut_{};
+
+  const char *operation_name() const noexcept {
+    switch (op_) {
+    case PeriodSweepOp::Union:
+      return "sweep_union";
+    case PeriodSweepOp::Intersection:
+      return "sweep_intersection";
+    case PeriodSweepOp::Difference:
+      return "sweep_difference";
+    }
+    return "sweep";
+  }
+
+  static period_type make(const endpoint_type &start, const endpoint_type &end) noexcept {
+    return period_type::from_storage(Bounds::make(start, end));
+  }
+
+  /// True when @p cursor is finished; records its failure, if any.
+  bool finished(const Cursor &cursor) {
+    if (cursor.status() != TEMPOCH_STATUS_T_OK && status_ == TEMPOCH_STATUS_T_OK)
+      status_ = cursor.status();
+    return cursor.done();
+  }
+
+  /// The live input with the smallest start, or nullptr.
+  Cursor *lowest_start() {
+    Cursor *best = nullptr;
+    for (auto &cursor : inputs_)
+      if (!finished(cursor) &&
+          (best == nullptr || detail::endpoint_less(cursor.start(), best->start())))
+        best = &cursor;
+    return best;
+  }
+
+  std::optional<period_type> next_union() {
+    Cursor *head = lowest_start();
+    if (head == nullptr)
+      return std::nullopt;
+    const endpoint_type start = head->start();
+    endpoint_type end = head->end();
+    head->advance();
+    // Absorb every period that overlaps or touches the growing one.
+    while ((head = lowest_start()) != nullptr && detail::endpoint_less_equal(head->start(), end)) {
+      end = detail::endpoint_max(end, head->end());
+      head->advance();
+    }
+    return make(start, end);
+  }
+
+  std::optional<period_type> next_intersection() {
+    if (inputs_.empty())
+      return std::nullopt;
+    for (;;) {
+      endpoint_type lo{};
+      endpoint_type hi{};
+      Cursor *first_end = nullptr;
+      for (auto &cursor : inputs_) {
+        if (finished(cursor))
+          return std::nullopt;
+        if (first_end == nullptr) {
+          lo = cursor.start();
+          hi = cursor.end();
+          first_end = &cursor;
+          continue;
+        }
+        lo = detail::endpoint_max(lo, cursor.start());
+        if (detail::endpoint_less(cursor.end(), hi)) {
+          hi = cursor.end();
+          first_end = &cursor;
+        }
+      }
+      first_end->advance();
+      if (detail::endpoint_less(lo, hi))
+        return make(lo, hi);
+    }
+  }
+
+  std::optional<period_type> next_difference() {
+    Cursor &a = inputs_[0];
+    Cursor &b = inputs_[1];
+    for (;;) {
+      if (finished(a))
+        return std::nullopt;
+      const endpoint_type end = a.end();
+      if (!cutting_) {
+        cut_ = a.start();
+        cutting_ = true;
+      }
+      while (!finished(b) && detail::endpoint_less_equal(b.end(), cut_))
+        b.advance();
+      if (status_ != TEMPOCH_STATUS_T_OK)
+        return std::nullopt;
+
+      if (b.done() || detail::endpoint_less_equal(end, b.start())) {
+        const endpoint_type start = cut_;
+        cutting_ = false;
+        a.advance();
+        return make(start, end);
+      }
+      const endpoint_type start = cut_;
+      cut_ = b.end();
+      if (!detail::endpoint_less(cut_, end)) {
+        cutting_ = false;
+        a.advance();
+      }
+      if (detail::endpoint_less(start, b.start()))
+        return make(start, b.start());
+    }
+  }
+};
+
+// -- Factories -----------------------------------------------------------------
+
+/// Lazy union of two sorted streams; overlapping and touching periods are merged.
+template <typename It>
+PeriodSweep<It> sweep_union(It a_first, It a_last, It b_first, It b_last) {
+  return PeriodSweep<It>(PeriodSweepOp::Union, {{std::move(a_first), std::move(a_last)},
+                                                {std::move(b_first), std::move(b_last)}});
+}
+
+/// Lazy union of any number of sorted streams (O(N) work per step).
+template <typename It> PeriodSweep<It> sweep_union(std::vector<std::pair<It, It>> inputs) {
+  return PeriodSweep<It>(PeriodSweepOp::Union, std::move(inputs));
+}
+
+/// Lazy intersection of two sorted streams.
+template <typename It>
+PeriodSweep<It> sweep_intersection(It a_first, It a_last, It b_first, It b_last) {
+  return PeriodSweep<It>(PeriodSweepOp::Intersection, {{std::move(a_first), std::move(a_last)},
+                                                       {std::move(b_first), std::move(b_last)}});
+}
+
+/// Lazy intersection of any number of sorted streams; empty when @p inputs is.
+template <typename It> PeriodSweep<It> sweep_intersection(std::vector<std::pair<It, It>> inputs) {
+  return PeriodSweep<It>(PeriodSweepOp::Intersection, std::move(inputs));
+}
+
+/// Lazy difference: the instants of the first stream that are not in the second.
+template <typename It>
+PeriodSweep<It> sweep_difference(It a_first, It a_last, It b_first, It b_last) {
+  return PeriodSweep<It>(PeriodSweepOp::Difference, {{std::move(a_first), std::move(a_last)},
+                                                     {std::move(b_first), std::move(b_last)}});
+}
+
+} // namespace tempoch
@@ -0,0 +1,142 @@
+#pragma once
+
+/**
+ * @file result.hpp
+ * @brief Status-returning counterpart of the throwing API.
+ *
+ * `Result<T>` holds either a value or an `Error` (the tempoch-ffi status plus
+ * the static name of the failing operation).  Building an error never
+ * allocates and never throws; `value()` on an error re-raises it through
+ * `check_status`, so callers can still opt back into exceptions at the edge.
+ */
+
+#include "ffi_core.hpp"
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace tempoch {
+
+/// Failure reported by a `checked_*` call.
+struct Error {
+  tempoch_status_t status = TEMPOCH_STATUS_T_OK;
+  /// Static, NUL-terminated name of the failing operation.
+  const char *operation = "";
+
+  const char *message() const noexcept { return status_message(status); }
+
+  /// Throw the exception `check_status` maps this status to.
+  [[noreturn]] void raise() const {
+    check_status(status, operation);
+    throw TempochException(std::string(operation) + " failed");
+  }
+};
+
+/**
+ * @brief Value-or-`Error`, in the spirit of `std::expected<T, Error>`.
+ */
+template <typename T> class [[nodiscard]] Result {
+  static_assert(!std::is_same_v<T, Error>, "Result<Error> is ambiguous");
+  std::variant<T, Error> state_;
+
+public:
+  using value_type = T;
+
+  Result(const T &value) : state_(std::in_place_index<0>, value) {}
+  Result(T &&value) : state_(std::in_place_index<0>, std::move(value)) {}
+  Result(const Error &error) noexcept : state_(std::in_place_index<1>, error) {}
+
+  /// `Error{status, operation}` unless @p status is OK, in which case @p value.
+  static Result from_status(tempoch_status_t status, const char *operation, T value) {
+    if (status != TEMPOCH_STATUS_T_OK)
+      return Result(Error{status, operation});
+    return Result(std::move(value));
+  }
+
+  bool ok() const noexcept { return state_.index() == 0; }
+  explicit operator bool() const noexcept { return ok(); }
+
+  /// `TEMPOCH_STATUS_T_OK` on success, the failing status otherwise.
+  tempoch_status_t status() const noexcept {
+    return ok() ? TEMPOCH_STATUS_T_OK : std::get<1>(state_).status;
+  }
+
+  /// The error; only meaningful when `!ok()`.
+  const Error &error() const noexcept { return *std::get_if<1>(&state_); }
+
+  /// The value, or the mapped exception when this holds an error.
+  const T &value() const & {
+    if (!ok())
+      error().raise();
+    return *std::get_if<0>(&state_);
+  }
+  T &value() & {
+    if (!ok())
+      error().raise();
+    return *std::get_if<0>(&state_);
+  }
+  T &&value() && {
+    if (!ok())
+      error().raise();
+    return std::move(*std::get_if<0>(&state_));
+  }
+
+  /// Unchecked access; only valid when `ok()`.
+  const T &operator*() const &noexcept { return *std::get_if<0>(&state_); }
+  T &operator*() &noexcept { return *std::get_if<0>(&state_); }
+  const T *operator->() const noexcept { return std::get_if<0>(&state_); }
+  T *operator->() noexcept { return std::get_if<0>(&state_); }
+
+  template <typename U> T value_or(U &&fallback) const & {
+    return ok() ? **this : static_cast<T>(std::forward<U>(fallback));
+  }
+
+  std::optional<T> to_optional() const & {
+    return ok() ? std::optional<T>(**this) : std::nullopt;
+  }
+
+  /// `Result<U>` holding `f(value)`, or this error unchanged.
+  template <typename Fn> auto map(Fn &&f) const & -> Result<std::invoke_result_t<Fn, const T &>> {
+    using U = std::invoke_result_t<Fn, const T &>;
+    if (!ok())
+      return Result<U>(error());
+    return Result<U>(std::forward<Fn>(f)(**this));
+  }
+
+  /// `f(value)` where `f` itself returns a `Result`, or this error unchanged.
+  template <typename Fn> auto and_then(Fn &&f) const & -> std::invoke_result_t<Fn, const T &> {
+    using R = std::invoke_result_t<Fn, const T &>;
+    if (!ok())
+      return R(error());
+    return std::forward<Fn>(f)(**this);
+  }
+};
+
+/// Success-or-`Error` for operations without a value.
+template <> class [[nodiscard]] Result<void> {
+  Error error_{};
+
+public:
+  using value_type = void;
+
+  Result() noexcept = default;
+  Result(const Error &error) noexcept : error_(error) {}
+
+  static Result from_status(tempoch_status_t status, const char *operation) noexcept {
+    return status == TEMPOCH_STATUS_T_OK ? Result() : Result(Error{status, operation});
+  }
+
+  bool ok() const noexcept { return error_.status == TEMPOCH_STATUS_T_OK; }
+  explicit operator bool() const noexcept { return ok(); }
+  tempoch_status_t status() const noexcept { return error_.status; }
+  const Error &error() const noexcept { return error_; }
+
+  void value() const {
+    if (!ok())
+      error_.raise();
+  }
+};
+
+} // namespace tempoch
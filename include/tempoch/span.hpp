@@ -0,0 +1,78 @@
+#pragma once
+
+/**
+ * @file span.hpp
+ * @brief Minimal contiguous view used by the batch and column APIs.
+ *
+ * A C++17 stand-in for `std::span<T>` (dynamic extent only).  It binds to raw
+ * pointer/length pairs, C arrays, and any contiguous container exposing
+ * `data()` / `size()` such as `std::vector` and `std::array`.
+ */
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace tempoch {
+
+template <typename T> class span {
+  T *data_ = nullptr;
+  std::size_t size_ = 0;
+
+  template <typename C>
+  using container_element_t = std::remove_pointer_t<decltype(std::declval<C &>().data())>;
+
+  template <typename U>
+  static constexpr bool is_compatible_v = std::is_convertible_v<U (*)[], T (*)[]>;
+
+public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using pointer = T *;
+  using reference = T &;
+  using iterator = T *;
+
+  constexpr span() noexcept = default;
+
+  constexpr span(T *data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+  template <typename U, std::size_t N, std::enable_if_t<is_compatible_v<U>, int> = 0>
+  constexpr span(U (&array)[N]) noexcept : data_(array), size_(N) {}
+
+  /// Bind to a mutable contiguous container (`std::vector`, `std::array`, ...).
+  template <typename C, std::enable_if_t<!std::is_same_v<std::remove_cv_t<C>, span> &&
+                                             is_compatible_v<container_element_t<C>>,
+                                         int> = 0>
+  constexpr span(C &container) noexcept : data_(container.data()), size_(container.size()) {}
+
+  /// Bind to a const (possibly temporary) container; only for views of `const T`.
+  template <typename C, std::enable_if_t<std::is_const_v<T> &&
+                                             !std::is_same_v<std::remove_cv_t<C>, span> &&
+                                             is_compatible_v<container_element_t<const C>>,
+                                         int> = 0>
+  constexpr span(const C &container) noexcept
+      : data_(container.data()), size_(container.size()) {}
+
+  /// Implicit `span<U>` → `span<const U>` conversion.
+  template <typename U, std::enable_if_t<!std::is_same_v<U, T> && is_compatible_v<U>, int> = 0>
+  constexpr span(const span<U> &other) noexcept : data_(other.data()), size_(other.size()) {}
+
+  constexpr T *data() const noexcept { return data_; }
+  constexpr std::size_t size() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr T *begin() const noexcept { return data_; }
+  constexpr T *end() const noexcept { return data_ + size_; }
+
+  constexpr T &operator[](std::size_t i) const noexcept { return data_[i]; }
+
+  /// View of @p count elements starting at @p offset (no bounds checking).
+  constexpr span subspan(std::size_t offset, std::size_t count) const noexcept {
+    return span(data_ + offset, count);
+  }
+
+  constexpr span first(std::size_t count) const noexcept { return span(data_, count); }
+};
+
+} // namespace tempoch
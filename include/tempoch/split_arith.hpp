@@ -0,0 +1,62 @@
+#pragma once
+
+/**
+ * @file split_arith.hpp
+ * @brief Error-free arithmetic on the `tempoch_time_t` hi/lo split.
+ *
+ * Building blocks for the header-only fast paths: a `tempoch_time_t` is an
+ * unevaluated sum `hi + lo` of two doubles, and these helpers keep the rounding
+ * error of each step in `lo` (Knuth two-sum, Dekker fast-two-sum).
+ */
+
+#include "ffi_core.hpp"
+
+namespace tempoch {
+namespace detail {
+
+/// Build a split pair without normalisation (usable in constant expressions).
+constexpr tempoch_time_t make_split(double hi, double lo) noexcept {
+  tempoch_time_t out{};
+  out.hi_seconds = hi;
+  out.lo_seconds = lo;
+  return out;
+}
+
+/// `std::isfinite` usable in constant expressions (NaN and ±inf give a NaN difference).
+constexpr bool is_finite(double x) noexcept { return x - x == 0.0; }
+
+/// Knuth two-sum: `a + b == sum + err` exactly, for any ordering of magnitudes.
+constexpr tempoch_time_t two_sum(double a, double b) noexcept {
+  const double sum = a + b;
+  const double b_virtual = sum - a;
+  const double a_virtual = sum - b_virtual;
+  const double err = (a - a_virtual) + (b - b_virtual);
+  return make_split(sum, err);
+}
+
+/// Dekker fast-two-sum; requires `|a| >= |b|` (or `a == 0`).
+constexpr tempoch_time_t fast_two_sum(double a, double b) noexcept {
+  const double sum = a + b;
+  const double err = b - (sum - a);
+  return make_split(sum, err);
+}
+
+/// Renormalise so that `hi` holds the rounded total and `lo` the residual.
+constexpr tempoch_time_t split_normalize(double hi, double lo) noexcept {
+  return two_sum(hi, lo);
+}
+
+/// `value + seconds`, carrying the rounding error of the high part into `lo`.
+constexpr tempoch_time_t split_add(const tempoch_time_t &value, double seconds) noexcept {
+  const tempoch_time_t s = two_sum(value.hi_seconds, seconds);
+  return fast_two_sum(s.hi_seconds, s.lo_seconds + value.lo_seconds);
+}
+
+/// `lhs - rhs` in seconds, rounded once at the end.
+constexpr double split_difference(const tempoch_time_t &lhs, const tempoch_time_t &rhs) noexcept {
+  const tempoch_time_t d = two_sum(lhs.hi_seconds, -rhs.hi_seconds);
+  return d.hi_seconds + (d.lo_seconds + (lhs.lo_seconds - rhs.lo_seconds));
+}
+
+} // namespace detail
+} // namespace tempoch
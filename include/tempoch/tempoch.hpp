@@ -7,16 +7,33 @@
  * Include this single header to get the full tempoch C++ API:
  *
  *   - `tempoch::Time<S>`         — split-storage instant on scale `S`
+ *   - `tempoch::Time<UTC>::now()` — system clock stamp (also `Time<TAI>::now()`)
  *   - `tempoch::JulianDate<S>`   — JD encoding on scale `S`
  *   - `tempoch::ModifiedJulianDate<S>`
  *   - `tempoch::CivilTime`       — civil UTC calendar label
+ *   - `tempoch::parse_iso8601()` — ISO 8601 / RFC 3339 timestamp parser
+ *   - `tempoch::to_chars()`      — locale-free formatting into caller buffers
+ *   - `tempoch::export_arrow()`  — zero-copy Arrow C Data Interface columns
  *   - `tempoch::TimeContext`     — explicit UT1 / historical UTC context
+ *   - `tempoch::Result<T>`       — value-or-`Error` returned by the `checked_*` API
+ *   - `tempoch::convert()`       — batch scale conversion with per-element status
+ *   - `tempoch::ConversionPlan`  — pre-resolved conversion route for hot loops
+ *   - `tempoch::refresh_leap_table()` — reload the native UTC leap-second snapshot
+ *   - `tempoch::ffi_stats()`     — tempoch-ffi call counters (`TEMPOCH_FFI_STATS=1` builds)
  *   - `tempoch::Period<T>`       — time period [start, end] with list operations
+ *   - `tempoch::PeriodSet<T>`    — normalized period set with O(log n) point queries
+ *   - `tempoch::PeriodIndex<T>`  — interval index over overlapping periods
+ *   - `tempoch::sweep_union()`   — lazy union / intersection / difference of sorted streams
+ *   - `tempoch::par`             — multi-threaded `normalize_periods(par, ...)`
  *   - `tempoch::EopValues`     — IERS Earth Orientation Parameter values
  *   - `tempoch::eop_at()`      — interpolate EOP at a UTC MJD
  *   - `tempoch::eop_covers()`  — check EOP data availability
  *   - `tempoch::constants::`   — named astronomical constants
  *
+ * `<tempoch/time_series.hpp>` (memory-mapped `Time<S>` column files) pulls in
+ * the platform mapping headers, so it is not part of this header; include it
+ * directly.
+ *
  * @code
  * #include <tempoch/tempoch.hpp>
  *
@@ -32,13 +49,26 @@
  * @endcode
  */
 
+#include "arrow.hpp"
+#include "batch.hpp"
+#include "clock.hpp"
 #include "constants.hpp"
+#include "conversion_plan.hpp"
 #include "data_status.hpp"
 #include "eop.hpp"
 #include "ffi_core.hpp"
+#include "ffi_stats.hpp"
 #include "formats/formats.hpp"
 #include "gnss_week.hpp"
+#include "iso8601.hpp"
+#include "leap_table.hpp"
+#include "parallel.hpp"
 #include "period.hpp"
+#include "period_index.hpp"
+#include "period_set.hpp"
+#include "period_sweep.hpp"
+#include "result.hpp"
 #include "scales/scales.hpp"
 #include "time.hpp"
 #include "time_base.hpp"
+#include "to_chars.hpp"
@@ -6,9 +6,15 @@
  */
 
 #include "civil_time.hpp"
+#include "clock.hpp"
 #include "ffi_core.hpp"
 #include "formats/formats.hpp"
+#include "leap_table.hpp"
+#include "native_formats.hpp"
+#include "native_scales.hpp"
+#include "result.hpp"
 #include "scales/scales.hpp"
+#include "split_arith.hpp"
 #include <cmath>
 #include <memory>
 #include <optional>
@@ -25,85 +31,341 @@ template <typename T> struct TimeTraits;
 namespace detail {
 
 struct ContextDeleter {
-  void operator()(tempoch_context_t *ptr) const noexcept { tempoch_context_free(ptr); }
+  void operator()(tempoch_context_t *ptr) const noexcept {
+    TEMPOCH_FFI_CALL(tempoch_context_free)(ptr);
+  }
 };
 
 inline std::shared_ptr<tempoch_context_t> make_default_context() {
   tempoch_context_t *raw = nullptr;
-  check_status(tempoch_context_create_default(&raw), "tempoch_context_create_default");
+  check_status(TEMPOCH_FFI_CALL(tempoch_context_create_default)(&raw),
+               "tempoch_context_create_default");
+  // Contexts mark the start of UTC work: build the leap-second snapshot off the hot path.
+  LeapTableRegistry::instance().ensure_built();
   return std::shared_ptr<tempoch_context_t>(raw, ContextDeleter{});
 }
 
 inline std::shared_ptr<tempoch_context_t> make_builtin_eop_context() {
   tempoch_context_t *raw = nullptr;
-  check_status(tempoch_context_create_with_builtin_eop(&raw),
+  check_status(TEMPOCH_FFI_CALL(tempoch_context_create_with_builtin_eop)(&raw),
                "tempoch_context_create_with_builtin_eop");
+  // Loading the builtin EOP may move the active bundle under the leap-second snapshot.
+  LeapTableRegistry::instance().observe(active_time_data_fingerprint());
   return std::shared_ptr<tempoch_context_t>(raw, ContextDeleter{});
 }
 
 inline std::shared_ptr<tempoch_context_t>
 make_pre_definition_context(const tempoch_context_t *parent) {
   tempoch_context_t *raw = nullptr;
-  check_status(tempoch_context_allow_pre_definition_utc(parent, &raw),
+  check_status(TEMPOCH_FFI_CALL(tempoch_context_allow_pre_definition_utc)(parent, &raw),
                "tempoch_context_allow_pre_definition_utc");
   return std::shared_ptr<tempoch_context_t>(raw, ContextDeleter{});
 }
 
-inline tempoch_time_t make_time(double hi_seconds, double lo_seconds) {
-  tempoch_time_t out{};
-  check_status(tempoch_time_new(hi_seconds, lo_seconds, &out), "tempoch_time_new");
-  return out;
+/// Validated, normalised split pair; mirrors `tempoch_time_new` without the FFI call.
+constexpr tempoch_time_t make_time(double hi_seconds, double lo_seconds) {
+  if (!is_finite(hi_seconds) || !is_finite(lo_seconds))
+    throw ConversionFailedError("tempoch_time_new failed: conversion failed");
+  return split_normalize(hi_seconds, lo_seconds);
+}
+
+/// Non-throwing `make_time`.
+constexpr tempoch_status_t try_make_time(double hi_seconds, double lo_seconds,
+                                         tempoch_time_t *out) noexcept {
+  if (!is_finite(hi_seconds) || !is_finite(lo_seconds))
+    return TEMPOCH_STATUS_T_CONVERSION_FAILED;
+  *out = split_normalize(hi_seconds, lo_seconds);
+  return TEMPOCH_STATUS_T_OK;
+}
+
+/// Default context shared by `try_to()`; created once, nullptr if creation failed.
+inline const tempoch_context_t *shared_default_context() noexcept {
+  static const std::shared_ptr<tempoch_context_t> handle =
+      []() noexcept -> std::shared_ptr<tempoch_context_t> {
+    try {
+      return make_default_context();
+    } catch (...) {
+      return nullptr;
+    }
+  }();
+  return handle.get();
+}
+
+/// True when @p ctx carries the built-in UTC policy the leap-second snapshot was built
+/// with: null or the shared default.  Any other context, including a fresh
+/// `TimeContext()`, goes to tempoch-ffi so its policy is honoured.
+inline bool uses_leap_table_policy(const tempoch_context_t *ctx) noexcept {
+  return ctx == nullptr || ctx == shared_default_context();
+}
+
+/// GPS epoch (1980-01-06T00:00:00 UTC) in GPST J2000 seconds; GPST = UTC there.
+inline constexpr double kGpsEpochGpstSeconds = -630'763'200.0;
+/// 1970-01-01T00:00:00 in J2000 seconds on the scale's own axis (10 957.5 days before J2000).
+inline constexpr double kUnixEpochUtcSeconds = -946'728'000.0;
+
+/// UTC to or from any scale with a native route to TAI, via the leap-second snapshot.
+template <typename From, typename To>
+inline constexpr bool has_leap_table_route_v =
+    (std::is_same_v<From, scale::UTC> && is_native_scale_v<To>) ||
+    (is_native_scale_v<From> && std::is_same_v<To, scale::UTC>);
+
+/// Convert through the leap-second snapshot; false means "ask tempoch-ffi".
+template <typename From, typename To>
+inline bool try_leap_table_convert(const tempoch_time_t &value, tempoch_time_t *out) noexcept {
+  double tai_minus_utc = 0.0;
+  if constexpr (std::is_same_v<From, scale::UTC>) {
+    if (!leap_tai_minus_utc(value.hi_seconds + value.lo_seconds, &tai_minus_utc))
+      return false;
+    const tempoch_time_t tai = split_add(value, tai_minus_utc);
+    if constexpr (std::is_same_v<To, scale::TAI>)
+      *out = tai;
+    else
+      *out = native_scale_convert<scale::TAI, To>(tai);
+  } else {
+    tempoch_time_t tai = value;
+    if constexpr (!std::is_same_v<From, scale::TAI>)
+      tai = native_scale_convert<From, scale::TAI>(value);
+    if (!leap_tai_minus_utc_from_tai(tai.hi_seconds + tai.lo_seconds, &tai_minus_utc))
+      return false;
+    *out = split_add(tai, -tai_minus_utc);
+  }
+  return true;
+}
+
+/// Non-throwing scale conversion; the status is returned instead of raised.
+///
+/// Pairs related by exact affine maps (see native_scales.hpp) never reach tempoch-ffi,
+/// and UTC pairs try the leap-second snapshot first when @p ctx allows it.
+template <typename From, typename To>
+inline tempoch_status_t try_scale_convert(const tempoch_time_t &value, const tempoch_context_t *ctx,
+                                          tempoch_time_t *out) noexcept {
+  if constexpr (std::is_same_v<From, To>) {
+    *out = value;
+    return TEMPOCH_STATUS_T_OK;
+  } else if constexpr (has_native_scale_route_v<From, To>) {
+    *out = native_scale_convert<From, To>(value);
+    return TEMPOCH_STATUS_T_OK;
+  } else {
+    if constexpr (has_leap_table_route_v<From, To>) {
+      if (uses_leap_table_policy(ctx) && try_leap_table_convert<From, To>(value, out))
+        return TEMPOCH_STATUS_T_OK;
+    }
+    return TEMPOCH_FFI_CALL(tempoch_time_scale_convert)(
+        value, static_cast<int32_t>(scale_tag_v<From>), static_cast<int32_t>(scale_tag_v<To>), ctx,
+        out);
+  }
 }
 
 template <typename From, typename To>
 inline tempoch_time_t scale_convert(const tempoch_time_t &value, const tempoch_context_t *ctx) {
   tempoch_time_t out{};
-  check_status(tempoch_time_scale_convert(value, static_cast<int32_t>(scale_tag_v<From>),
-                                          static_cast<int32_t>(scale_tag_v<To>), ctx, &out),
-               "tempoch_time_scale_convert");
+  check_status(try_scale_convert<From, To>(value, ctx, &out), "tempoch_time_scale_convert");
   return out;
 }
 
+/// GPS seconds on TAI: TAI seconds since the GPS epoch, 1980-01-06T00:00:19 TAI.
+///
+/// The epoch is `constants::gps_epoch_jd_tai()`, a whole number of seconds
+/// from J2000, so encoding rounds once as `(hi + c) + lo`, like the UTC Unix
+/// route, and decoding is exact.  The C ABI does not say whether GPS and Unix
+/// counts on the other scales are taken on that scale's axis or on TAI / UTC,
+/// so those stay on tempoch-ffi.
+template <typename S, typename F>
+inline constexpr bool has_gps_seconds_route_v =
+    std::is_same_v<S, scale::TAI> && std::is_same_v<F, format::GPS>;
+
+/// GPS seconds minus TAI J2000 seconds.
+inline constexpr double kGpsSecondsMinusTai =
+    -(kGpsEpochGpstSeconds - FixedOffsetScale<scale::GPST>::offset_from_tai);
+
+/// Non-throwing encode of split storage into format @p F (J2000 seconds on continuous
+/// scales are read straight from the split pair).
+template <typename S, typename F>
+inline tempoch_status_t try_encode_time(const tempoch_time_t &value, const tempoch_context_t *ctx,
+                                        double *out) noexcept {
+  if constexpr (has_native_split_codec_v<S, F>) {
+    *out = value.hi_seconds + value.lo_seconds;
+    return TEMPOCH_STATUS_T_OK;
+  } else {
+    if constexpr (std::is_same_v<S, scale::UTC> && std::is_same_v<F, format::Unix>) {
+      double unix_minus_utc = 0.0;
+      if (uses_leap_table_policy(ctx) &&
+          leap_unix_minus_utc(value.hi_seconds + value.lo_seconds, &unix_minus_utc)) {
+        *out = (value.hi_seconds + unix_minus_utc) + value.lo_seconds;
+        return TEMPOCH_STATUS_T_OK;
+      }
+    }
+    if constexpr (has_gps_seconds_route_v<S, F>) {
+      *out = (value.hi_seconds + kGpsSecondsMinusTai) + value.lo_seconds;
+      return TEMPOCH_STATUS_T_OK;
+    }
+    return TEMPOCH_FFI_CALL(tempoch_time_to_format)(value, static_cast<int32_t>(scale_tag_v<S>),
+                                                    static_cast<int32_t>(format_tag_v<F>), ctx,
+                                                    out);
+  }
+}
+
+/// Non-throwing decode of a raw value in format @p F into split storage.
+template <typename S, typename F>
+inline tempoch_status_t try_decode_time(double raw, const tempoch_context_t *ctx,
+                                        tempoch_time_t *out) noexcept {
+  if constexpr (has_native_split_codec_v<S, F>) {
+    if (!std::isfinite(raw))
+      return TEMPOCH_STATUS_T_CONVERSION_FAILED;
+    *out = make_split(raw, 0.0);
+    return TEMPOCH_STATUS_T_OK;
+  } else {
+    if constexpr (std::is_same_v<S, scale::UTC> && std::is_same_v<F, format::Unix>) {
+      double unix_minus_utc = 0.0;
+      if (uses_leap_table_policy(ctx) && leap_unix_minus_utc_from_unix(raw, &unix_minus_utc)) {
+        *out = split_add(make_split(raw, 0.0), -unix_minus_utc);
+        return TEMPOCH_STATUS_T_OK;
+      }
+    }
+    if constexpr (has_gps_seconds_route_v<S, F>) {
+      if (!std::isfinite(raw))
+        return TEMPOCH_STATUS_T_CONVERSION_FAILED;
+      *out = split_add(make_split(raw, 0.0), -kGpsSecondsMinusTai);
+      return TEMPOCH_STATUS_T_OK;
+    }
+    return TEMPOCH_FFI_CALL(tempoch_time_from_format)(raw, static_cast<int32_t>(scale_tag_v<S>),
+                                                      static_cast<int32_t>(format_tag_v<F>), ctx,
+                                                      out);
+  }
+}
+
 template <typename S, typename F>
 inline double encode_time(const tempoch_time_t &value, const tempoch_context_t *ctx) {
   double out = 0.0;
-  check_status(tempoch_time_to_format(value, static_cast<int32_t>(scale_tag_v<S>),
-                                      static_cast<int32_t>(format_tag_v<F>), ctx, &out),
-               "tempoch_time_to_format");
+  check_status(try_encode_time<S, F>(value, ctx, &out), "tempoch_time_to_format");
   return out;
 }
 
 template <typename S, typename F>
 inline tempoch_time_t decode_time(double raw, const tempoch_context_t *ctx) {
   tempoch_time_t out{};
-  check_status(tempoch_time_from_format(raw, static_cast<int32_t>(scale_tag_v<S>),
-                                        static_cast<int32_t>(format_tag_v<F>), ctx, &out),
-               "tempoch_time_from_format");
+  check_status(try_decode_time<S, F>(raw, ctx, &out), "tempoch_time_from_format");
   return out;
 }
 
+/// Non-throwing current instant on UTC or TAI; see clock.hpp.
+template <typename S> inline tempoch_status_t try_now(tempoch_time_t *out) noexcept {
+  ClockReading clock{};
+  if constexpr (std::is_same_v<S, scale::TAI>) {
+    // 1970-01-01T00:00:00 TAI has the same J2000 second count as the Unix epoch on UTC.
+    if (read_kernel_tai_clock(&clock)) {
+      *out = fast_two_sum(static_cast<double>(clock.seconds) + kUnixEpochUtcSeconds,
+                          static_cast<double>(clock.nanoseconds) * 1.0e-9);
+      return TEMPOCH_STATUS_T_OK;
+    }
+  }
+  clock = read_unix_clock();
+  UnixSecondCache &cache = thread_unix_second_cache();
+  const uint64_t generation =
+      LeapTableRegistry::instance().generation.load(std::memory_order_acquire);
+  if (clock.seconds != cache.seconds || generation != cache.generation) {
+    const tempoch_status_t status = try_decode_time<scale::UTC, format::Unix>(
+        static_cast<double>(clock.seconds), nullptr, &cache.utc);
+    if (status != TEMPOCH_STATUS_T_OK) {
+      cache.generation = ~uint64_t{0};
+      return status;
+    }
+    cache.seconds = clock.seconds;
+    cache.generation = generation;
+  }
+  const tempoch_time_t utc =
+      split_add(cache.utc, static_cast<double>(clock.nanoseconds) * 1.0e-9);
+  if constexpr (std::is_same_v<S, scale::UTC>) {
+    *out = utc;
+    return TEMPOCH_STATUS_T_OK;
+  } else {
+    return try_scale_convert<scale::UTC, S>(utc, nullptr, out);
+  }
+}
+
+/// Non-throwing civil UTC → split storage.
+inline tempoch_status_t try_time_from_civil(const CivilTime &civil, const tempoch_context_t *ctx,
+                                            tempoch_time_t *out) noexcept {
+  return TEMPOCH_FFI_CALL(tempoch_time_from_civil)(civil.to_c(), ctx, out);
+}
+
+/// Non-throwing split storage → civil UTC.
+inline tempoch_status_t try_time_to_civil(const tempoch_time_t &value, const tempoch_context_t *ctx,
+                                          CivilTime *out) noexcept {
+  tempoch_utc_t raw{};
+  const tempoch_status_t status = TEMPOCH_FFI_CALL(tempoch_time_to_civil)(value, ctx, &raw);
+  if (status == TEMPOCH_STATUS_T_OK)
+    *out = CivilTime::from_c(raw);
+  return status;
+}
+
 inline tempoch_time_t time_from_civil(const CivilTime &civil, const tempoch_context_t *ctx) {
   tempoch_time_t out{};
-  check_status(tempoch_time_from_civil(civil.to_c(), ctx, &out), "tempoch_time_from_civil");
+  check_status(try_time_from_civil(civil, ctx, &out), "tempoch_time_from_civil");
   return out;
 }
 
 inline CivilTime time_to_civil(const tempoch_time_t &value, const tempoch_context_t *ctx) {
-  tempoch_utc_t out{};
-  check_status(tempoch_time_to_civil(value, ctx, &out), "tempoch_time_to_civil");
-  return CivilTime::from_c(out);
+  CivilTime out;
+  check_status(try_time_to_civil(value, ctx, &out), "tempoch_time_to_civil");
+  return out;
 }
 
+/// Exact SI seconds per unit for the common duration quantities.
+template <typename Q> struct SecondsPerUnit : std::false_type {};
+template <> struct SecondsPerUnit<qtty::Second> : std::true_type {
+  static constexpr double seconds = 1.0;
+};
+template <> struct SecondsPerUnit<qtty::Minute> : std::true_type {
+  static constexpr double seconds = 60.0;
+};
+template <> struct SecondsPerUnit<qtty::Hour> : std::true_type {
+  static constexpr double seconds = 3'600.0;
+};
+template <> struct SecondsPerUnit<qtty::Day> : std::true_type {
+  static constexpr double seconds = 86'400.0;
+};
+template <> struct SecondsPerUnit<qtty::JulianCentury> : std::true_type {
+  static constexpr double seconds = 86'400.0 * 36'525.0;
+};
+
+/// Quantities qtty itself converts to `qtty::Second`, i.e. every other time unit.
+template <typename Q, typename = void> struct ConvertsToSeconds : std::false_type {};
+template <typename Q>
+struct ConvertsToSeconds<
+    Q, std::void_t<decltype(std::declval<const Q &>().template to<qtty::Second>().value())>>
+    : std::true_type {};
+
+template <typename Q>
+inline constexpr bool has_native_unit_v = SecondsPerUnit<Q>::value || ConvertsToSeconds<Q>::value;
+
 template <typename Q> inline tempoch_time_t add_seconds(const tempoch_time_t &value, const Q &qty) {
+  // Known units: one scaling plus a two-sum on the split.  The FFI keeps other
+  // units and non-finite deltas so its error reporting is unchanged; testing the
+  // delta rather than the sum keeps the check off the stepping dependency chain.
+  if constexpr (has_native_unit_v<Q>) {
+    double seconds = 0.0;
+    if constexpr (SecondsPerUnit<Q>::value)
+      seconds = qty.value() * SecondsPerUnit<Q>::seconds;
+    else
+      seconds = qty.template to<qtty::Second>().value();
+    if (std::isfinite(seconds))
+      return split_add(value, seconds);
+  }
   tempoch_time_t out{};
   qtty_quantity_t raw{qty.value(), qtty::UnitTraits<typename Q::unit_tag>::unit_id()};
-  check_status(tempoch_time_add_seconds(value, raw, &out), "tempoch_time_add_seconds");
+  check_status(TEMPOCH_FFI_CALL(tempoch_time_add_seconds)(value, raw, &out),
+               "tempoch_time_add_seconds");
   return out;
 }
 
 inline qtty::Second difference_seconds(const tempoch_time_t &lhs, const tempoch_time_t &rhs) {
+  const double native = split_difference(lhs, rhs);
+  if (std::isfinite(native))
+    return qtty::Second(native);
   double out = 0.0;
-  check_status(tempoch_time_difference_seconds(lhs, rhs, &out), "tempoch_time_difference_seconds");
+  check_status(TEMPOCH_FFI_CALL(tempoch_time_difference_seconds)(lhs, rhs, &out),
+               "tempoch_time_difference_seconds");
   return qtty::Second(out);
 }
 
@@ -111,8 +373,8 @@ template <typename F> inline typename FormatTraits<F>::quantity_type quantity_fr
   return typename FormatTraits<F>::quantity_type(raw);
 }
 
-template <typename F> inline void ensure_finite_encoded(double raw, const char *operation) {
-  if (!std::isfinite(raw))
+template <typename F> constexpr void ensure_finite_encoded(double raw, const char *operation) {
+  if (!is_finite(raw))
     throw ConversionFailedError(std::string(operation) + " failed: non-finite raw value");
 }
 
@@ -146,7 +408,7 @@ template <typename S> class Time {
 
   tempoch_time_t raw_;
 
-  explicit Time(const tempoch_time_t &raw) : raw_(raw) {}
+  constexpr explicit Time(const tempoch_time_t &raw) noexcept : raw_(raw) {}
 
   template <typename> friend class Time;
   template <typename, typename> friend class EncodedTime;
@@ -154,13 +416,62 @@ template <typename S> class Time {
 public:
   using scale_type = S;
 
-  Time() : raw_(detail::make_time(0.0, 0.0)) {}
+  /// The J2000.0 instant on scale @p S.
+  constexpr Time() noexcept : raw_(detail::make_split(0.0, 0.0)) {}
 
-  static Time from_split_seconds(qtty::Second hi, qtty::Second lo = qtty::Second(0.0)) {
+  /// Validated, normalised construction; usable in constant expressions.
+  static constexpr Time from_split_seconds(qtty::Second hi, qtty::Second lo = qtty::Second(0.0)) {
     return Time(detail::make_time(hi.value(), lo.value()));
   }
 
-  static Time from_raw_j2000_seconds(qtty::Second seconds) { return from_split_seconds(seconds); }
+  static constexpr Time from_raw_j2000_seconds(qtty::Second seconds) {
+    return from_split_seconds(seconds);
+  }
+
+  /// Wrap a split pair already produced by tempoch-ffi (no validation or FFI call).
+  static constexpr Time from_c(const tempoch_time_t &raw) noexcept { return Time(raw); }
+
+  /// J2000.0 (JD 2451545.0 on the scale's own axis).
+  static constexpr Time j2000() noexcept { return Time(); }
+
+  /// GPS epoch, 1980-01-06T00:00:00 UTC, on UTC or a scale with a native route from GPST.
+  template <typename U = S,
+            std::enable_if_t<std::is_same_v<U, scale::UTC> || detail::is_native_scale_v<U>, int> = 0>
+  static constexpr Time gps_epoch() noexcept {
+    constexpr tempoch_time_t gpst = detail::make_split(detail::kGpsEpochGpstSeconds, 0.0);
+    if constexpr (std::is_same_v<U, scale::UTC> || std::is_same_v<U, scale::GPST>)
+      return Time(gpst);
+    else
+      return Time(detail::native_scale_convert<scale::GPST, U>(gpst));
+  }
+
+  /// Unix epoch: the UTC instant whose `format::Unix` encoding is zero.
+  ///
+  /// Decoded from Unix 0 once per process.  tempoch-ffi applies the pre-1972
+  /// UTC definition there, so the result need not be exactly
+  /// `kUnixEpochUtcSeconds` on the split axis; that value is only used if
+  /// decoding fails.
+  template <typename U = S, std::enable_if_t<std::is_same_v<U, scale::UTC>, int> = 0>
+  static Time unix_epoch() noexcept {
+    static const Time epoch = [] {
+      tempoch_time_t split{};
+      if (detail::try_decode_time<scale::UTC, format::Unix>(0.0, nullptr, &split) !=
+          TEMPOCH_STATUS_T_OK)
+        split = detail::make_split(detail::kUnixEpochUtcSeconds, 0.0);
+      return Time(split);
+    }();
+    return epoch;
+  }
+
+  /// Current instant from the system clock (see clock.hpp); UTC and TAI only.
+  template <typename U = S, std::enable_if_t<std::is_same_v<U, scale::UTC> ||
+                                                 std::is_same_v<U, scale::TAI>,
+                                             int> = 0>
+  static Time now() {
+    tempoch_time_t raw{};
+    check_status(detail::try_now<U>(&raw), "tempoch::Time::now");
+    return Time(raw);
+  }
 
   /// Decode a scalar encoding @p Fmt into canonical split storage on scale @p S (default context).
   template <typename Fmt> static Time from_encoded(const EncodedTime<S, Fmt> &encoded) {
@@ -173,15 +484,15 @@ public:
     return Time(detail::decode_time<S, Fmt>(encoded.value(), ctx.get()));
   }
 
-  std::pair<qtty::Second, qtty::Second> split_seconds() const noexcept {
+  constexpr std::pair<qtty::Second, qtty::Second> split_seconds() const noexcept {
     return {qtty::Second(raw_.hi_seconds), qtty::Second(raw_.lo_seconds)};
   }
 
-  qtty::Second total_seconds() const noexcept {
+  constexpr qtty::Second total_seconds() const noexcept {
     return qtty::Second(raw_.hi_seconds + raw_.lo_seconds);
   }
 
-  const tempoch_time_t &c_inner() const noexcept { return raw_; }
+  constexpr const tempoch_time_t &c_inner() const noexcept { return raw_; }
 
   static constexpr const char *label() { return ScaleTraits<S>::name(); }
 
@@ -248,24 +559,157 @@ public:
         detail::encode_time<S, TargetFormat>(raw_, ctx.get())));
   }
 
+  // -- Non-throwing API ------------------------------------------------------
+  //
+  // `checked_*` mirror the throwing calls above but report failures as a
+  // `Result`; no exception is thrown and nothing is allocated on the error path.
+
+  static Result<Time> checked_from_split_seconds(qtty::Second hi,
+                                                 qtty::Second lo = qtty::Second(0.0)) noexcept {
+    tempoch_time_t out{};
+    return from_status(detail::try_make_time(hi.value(), lo.value(), &out), "tempoch_time_new",
+                       out);
+  }
+
+  template <typename Fmt>
+  static Result<Time> checked_from_encoded(const EncodedTime<S, Fmt> &encoded) noexcept {
+    return checked_decode<Fmt>(encoded.value(), nullptr);
+  }
+
+  template <typename Fmt>
+  static Result<Time> checked_from_encoded_with(const EncodedTime<S, Fmt> &encoded,
+                                                const TimeContext &ctx) noexcept {
+    return checked_decode<Fmt>(encoded.value(), ctx.get());
+  }
+
+  template <typename U = S, std::enable_if_t<std::is_same_v<U, scale::UTC>, int> = 0>
+  static Result<Time> checked_from_civil(const CivilTime &civil) noexcept {
+    tempoch_time_t out{};
+    return from_status(detail::try_time_from_civil(civil, nullptr, &out), "tempoch_time_from_civil",
+                       out);
+  }
+
+  template <typename U = S, std::enable_if_t<std::is_same_v<U, scale::UTC>, int> = 0>
+  static Result<Time> checked_from_civil(const CivilTime &civil, const TimeContext &ctx) noexcept {
+    tempoch_time_t out{};
+    return from_status(detail::try_time_from_civil(civil, ctx.get(), &out),
+                       "tempoch_time_from_civil", out);
+  }
+
+  template <typename U = S, std::enable_if_t<std::is_same_v<U, scale::UTC>, int> = 0>
+  Result<CivilTime> checked_to_civil() const noexcept {
+    return checked_civil(nullptr);
+  }
+
+  template <typename U = S, std::enable_if_t<std::is_same_v<U, scale::UTC>, int> = 0>
+  Result<CivilTime> checked_to_civil(const TimeContext &ctx) const noexcept {
+    return checked_civil(ctx.get());
+  }
+
+  template <typename TargetScale,
+            std::enable_if_t<is_scale_v<TargetScale> && !std::is_same_v<S, scale::UT1> &&
+                                 !std::is_same_v<TargetScale, scale::UT1>,
+                             int> = 0>
+  Result<Time<TargetScale>> checked_to() const noexcept {
+    return checked_scale<TargetScale>(nullptr);
+  }
+
+  template <typename TargetScale, std::enable_if_t<is_scale_v<TargetScale>, int> = 0>
+  Result<Time<TargetScale>> checked_to_with(const TimeContext &ctx) const noexcept {
+    return checked_scale<TargetScale>(ctx.get());
+  }
+
+  template <typename TargetFormat, std::enable_if_t<is_format_v<TargetFormat>, int> = 0>
+  Result<EncodedTime<S, TargetFormat>> checked_to() const noexcept {
+    return checked_encode<TargetFormat>(nullptr);
+  }
+
+  template <typename TargetFormat, std::enable_if_t<is_format_v<TargetFormat>, int> = 0>
+  Result<EncodedTime<S, TargetFormat>> checked_to_with(const TimeContext &ctx) const noexcept {
+    return checked_encode<TargetFormat>(ctx.get());
+  }
+
+  template <typename TargetScale, typename TargetFormat,
+            std::enable_if_t<is_scale_v<TargetScale> && is_format_v<TargetFormat> &&
+                                 !std::is_same_v<S, scale::UT1> &&
+                                 !std::is_same_v<TargetScale, scale::UT1>,
+                             int> = 0>
+  Result<EncodedTime<TargetScale, TargetFormat>> checked_to() const noexcept {
+    return checked_scale_encode<TargetScale, TargetFormat>(nullptr);
+  }
+
+  template <typename TargetScale, typename TargetFormat,
+            std::enable_if_t<is_scale_v<TargetScale> && is_format_v<TargetFormat>, int> = 0>
+  Result<EncodedTime<TargetScale, TargetFormat>>
+  checked_to_with(const TimeContext &ctx) const noexcept {
+    return checked_scale_encode<TargetScale, TargetFormat>(ctx.get());
+  }
+
+  /// `to_with<TargetScale>(TimeContext())` as an optional, on a shared default context.
   template <typename TargetScale, std::enable_if_t<is_scale_v<TargetScale>, int> = 0>
   std::optional<Time<TargetScale>> try_to() const {
-    try {
-      return to_with<TargetScale>(TimeContext());
-    } catch (const std::exception &) {
-      return std::nullopt;
-    }
+    return checked_scale<TargetScale>(detail::shared_default_context()).to_optional();
   }
 
   template <typename TargetFormat, std::enable_if_t<is_format_v<TargetFormat>, int> = 0>
   std::optional<EncodedTime<S, TargetFormat>> try_to() const {
-    try {
-      return to_with<TargetFormat>(TimeContext());
-    } catch (const std::exception &) {
-      return std::nullopt;
-    }
+    return checked_encode<TargetFormat>(detail::shared_default_context()).to_optional();
+  }
+
+private:
+  static Result<Time> from_status(tempoch_status_t status, const char *operation,
+                                  const tempoch_time_t &raw) noexcept {
+    if (status != TEMPOCH_STATUS_T_OK)
+      return Error{status, operation};
+    return Time(raw);
+  }
+
+  template <typename Fmt>
+  static Result<Time> checked_decode(double raw, const tempoch_context_t *ctx) noexcept {
+    tempoch_time_t out{};
+    return from_status(detail::try_decode_time<S, Fmt>(raw, ctx, &out), "tempoch_time_from_format",
+                       out);
+  }
+
+  Result<CivilTime> checked_civil(const tempoch_context_t *ctx) const noexcept {
+    CivilTime out;
+    const tempoch_status_t status = detail::try_time_to_civil(raw_, ctx, &out);
+    if (status != TEMPOCH_STATUS_T_OK)
+      return Error{status, "tempoch_time_to_civil"};
+    return out;
+  }
+
+  template <typename TargetScale>
+  Result<Time<TargetScale>> checked_scale(const tempoch_context_t *ctx) const noexcept {
+    tempoch_time_t out{};
+    const tempoch_status_t status = detail::try_scale_convert<S, TargetScale>(raw_, ctx, &out);
+    if (status != TEMPOCH_STATUS_T_OK)
+      return Error{status, "tempoch_time_scale_convert"};
+    return Time<TargetScale>(out);
+  }
+
+  template <typename TargetFormat>
+  Result<EncodedTime<S, TargetFormat>> checked_encode(const tempoch_context_t *ctx) const noexcept {
+    double out = 0.0;
+    tempoch_status_t status = detail::try_encode_time<S, TargetFormat>(raw_, ctx, &out);
+    if (status == TEMPOCH_STATUS_T_OK && !std::isfinite(out))
+      status = TEMPOCH_STATUS_T_CONVERSION_FAILED;
+    if (status != TEMPOCH_STATUS_T_OK)
+      return Error{status, "tempoch_time_to_format"};
+    return EncodedTime<S, TargetFormat>(out);
+  }
+
+  template <typename TargetScale, typename TargetFormat>
+  Result<EncodedTime<TargetScale, TargetFormat>>
+  checked_scale_encode(const tempoch_context_t *ctx) const noexcept {
+    const auto converted = checked_scale<TargetScale>(ctx);
+    if (!converted)
+      return converted.error();
+    return converted->template checked_encode<TargetFormat>(ctx);
   }
 
+public:
+
   template <typename Q> Time operator+(const Q &delta) const {
     return Time(detail::add_seconds(raw_, delta));
   }
@@ -286,20 +730,20 @@ public:
     return detail::difference_seconds(raw_, other.raw_);
   }
 
-  bool operator==(const Time &other) const noexcept {
+  constexpr bool operator==(const Time &other) const noexcept {
     return raw_.hi_seconds == other.raw_.hi_seconds && raw_.lo_seconds == other.raw_.lo_seconds;
   }
 
-  bool operator!=(const Time &other) const noexcept { return !(*this == other); }
+  constexpr bool operator!=(const Time &other) const noexcept { return !(*this == other); }
 
-  bool operator<(const Time &other) const noexcept {
+  constexpr bool operator<(const Time &other) const noexcept {
     return raw_.hi_seconds < other.raw_.hi_seconds ||
            (raw_.hi_seconds == other.raw_.hi_seconds && raw_.lo_seconds < other.raw_.lo_seconds);
   }
 
-  bool operator<=(const Time &other) const noexcept { return !(other < *this); }
-  bool operator>(const Time &other) const noexcept { return other < *this; }
-  bool operator>=(const Time &other) const noexcept { return !(*this < other); }
+  constexpr bool operator<=(const Time &other) const noexcept { return !(other < *this); }
+  constexpr bool operator>(const Time &other) const noexcept { return other < *this; }
+  constexpr bool operator>=(const Time &other) const noexcept { return !(*this < other); }
 };
 
 template <typename S> inline std::ostream &operator<<(std::ostream &os, const Time<S> &time) {
@@ -322,13 +766,13 @@ private:
   quantity_type raw_;
 
 public:
-  EncodedTime() : raw_(0.0) {}
+  constexpr EncodedTime() : raw_(0.0) {}
 
-  explicit EncodedTime(quantity_type raw) : raw_(raw) {
+  constexpr explicit EncodedTime(quantity_type raw) : raw_(raw) {
     detail::ensure_finite_encoded<F>(raw_.value(), "EncodedTime::EncodedTime");
   }
 
-  explicit EncodedTime(double value) : EncodedTime(quantity_type(value)) {}
+  constexpr explicit EncodedTime(double value) : EncodedTime(quantity_type(value)) {}
 
   static std::optional<EncodedTime> try_new(quantity_type raw) {
     if (!std::isfinite(raw.value()))
@@ -339,15 +783,21 @@ public:
   /// Construct directly from a quantity, validating that the value is finite.
   ///
   /// Unlike `try_new`, this throws `TempochException` on non-finite input.
-  static EncodedTime from_raw(quantity_type raw) { return EncodedTime(raw); }
-
-  quantity_type raw() const noexcept { return raw_; }
-  quantity_type quantity() const noexcept { return raw_; }
-  double value() const noexcept { return raw_.value(); }
-
-  template <typename U = F, std::enable_if_t<std::is_same_v<U, format::JD>, int> = 0>
-  static EncodedTime J2000() {
-    return EncodedTime(tempoch_const_j2000_jd_tt());
+  static constexpr EncodedTime from_raw(quantity_type raw) { return EncodedTime(raw); }
+
+  constexpr quantity_type raw() const noexcept { return raw_; }
+  constexpr quantity_type quantity() const noexcept { return raw_; }
+  constexpr double value() const noexcept { return raw_.value(); }
+
+  /// J2000.0 on scale @p S in a day-count or J2000-second encoding.
+  template <typename U = F, std::enable_if_t<detail::is_day_count_format_v<U> ||
+                                                 std::is_same_v<U, format::J2000s>,
+                                             int> = 0>
+  static constexpr EncodedTime J2000() {
+    if constexpr (std::is_same_v<U, format::J2000s>)
+      return EncodedTime(0.0);
+    else
+      return EncodedTime(detail::day_count_epoch<U>());
   }
 
   template <typename TargetScale, std::enable_if_t<is_scale_v<TargetScale>, int> = 0>
@@ -372,34 +822,116 @@ public:
     return Time<S>::from_encoded_with(*this, ctx).template to_with<TargetScale, TargetFormat>(ctx);
   }
 
+  /// Change format on the same scale; JD / MJD / J2000s changes are done in the header.
   template <typename TargetFormat, std::enable_if_t<is_format_v<TargetFormat>, int> = 0>
   EncodedTime<S, TargetFormat> to() const {
-    return Time<S>::from_encoded(*this).template to<TargetFormat>();
+    if constexpr (std::is_same_v<TargetFormat, F>) {
+      return *this;
+    } else if constexpr (detail::has_native_format_route_v<S, F, TargetFormat>) {
+      return EncodedTime<S, TargetFormat>(
+          detail::native_transcode<S, F, TargetFormat>(raw_.value()));
+    } else {
+      return Time<S>::from_encoded(*this).template to<TargetFormat>();
+    }
   }
 
   template <typename TargetFormat, std::enable_if_t<is_format_v<TargetFormat>, int> = 0>
   EncodedTime<S, TargetFormat> to_with(const TimeContext &ctx) const {
-    return Time<S>::from_encoded_with(*this, ctx).template to_with<TargetFormat>(ctx);
+    if constexpr (std::is_same_v<TargetFormat, F> ||
+                  detail::has_native_format_route_v<S, F, TargetFormat>) {
+      return this->template to<TargetFormat>();
+    } else {
+      return Time<S>::from_encoded_with(*this, ctx).template to_with<TargetFormat>(ctx);
+    }
+  }
+
+  template <typename TargetScale,
+            std::enable_if_t<is_scale_v<TargetScale> && !std::is_same_v<S, scale::UT1> &&
+                                 !std::is_same_v<TargetScale, scale::UT1>,
+                             int> = 0>
+  Result<Time<TargetScale>> checked_to() const noexcept {
+    return checked_to_scale<TargetScale>(nullptr);
+  }
+
+  template <typename TargetScale, std::enable_if_t<is_scale_v<TargetScale>, int> = 0>
+  Result<Time<TargetScale>> checked_to_with(const TimeContext &ctx) const noexcept {
+    return checked_to_scale<TargetScale>(ctx.get());
+  }
+
+  template <typename TargetScale, typename TargetFormat,
+            std::enable_if_t<is_scale_v<TargetScale> && is_format_v<TargetFormat> &&
+                                 !std::is_same_v<S, scale::UT1> &&
+                                 !std::is_same_v<TargetScale, scale::UT1>,
+                             int> = 0>
+  Result<EncodedTime<TargetScale, TargetFormat>> checked_to() const noexcept {
+    return checked_to_scale_format<TargetScale, TargetFormat>(nullptr);
+  }
+
+  template <typename TargetScale, typename TargetFormat,
+            std::enable_if_t<is_scale_v<TargetScale> && is_format_v<TargetFormat>, int> = 0>
+  Result<EncodedTime<TargetScale, TargetFormat>>
+  checked_to_with(const TimeContext &ctx) const noexcept {
+    return checked_to_scale_format<TargetScale, TargetFormat>(ctx.get());
+  }
+
+  template <typename TargetFormat, std::enable_if_t<is_format_v<TargetFormat>, int> = 0>
+  Result<EncodedTime<S, TargetFormat>> checked_to() const noexcept {
+    return checked_to_format<TargetFormat>(nullptr);
   }
 
+  template <typename TargetFormat, std::enable_if_t<is_format_v<TargetFormat>, int> = 0>
+  Result<EncodedTime<S, TargetFormat>> checked_to_with(const TimeContext &ctx) const noexcept {
+    return checked_to_format<TargetFormat>(ctx.get());
+  }
+
+  /// `to_with<TargetScale>(TimeContext())` as an optional, on a shared default context.
   template <typename TargetScale, std::enable_if_t<is_scale_v<TargetScale>, int> = 0>
   std::optional<Time<TargetScale>> try_to() const {
-    try {
-      return to_with<TargetScale>(TimeContext());
-    } catch (const std::exception &) {
-      return std::nullopt;
-    }
+    return checked_to_scale<TargetScale>(detail::shared_default_context()).to_optional();
   }
 
   template <typename TargetFormat, std::enable_if_t<is_format_v<TargetFormat>, int> = 0>
   std::optional<EncodedTime<S, TargetFormat>> try_to() const {
-    try {
-      return to_with<TargetFormat>(TimeContext());
-    } catch (const std::exception &) {
-      return std::nullopt;
+    return checked_to_format<TargetFormat>(detail::shared_default_context()).to_optional();
+  }
+
+private:
+  template <typename TargetScale>
+  Result<Time<TargetScale>> checked_to_scale(const tempoch_context_t *ctx) const noexcept {
+    const Result<Time<S>> decoded = Time<S>::template checked_decode<F>(raw_.value(), ctx);
+    if (!decoded)
+      return decoded.error();
+    return decoded->template checked_scale<TargetScale>(ctx);
+  }
+
+  template <typename TargetScale, typename TargetFormat>
+  Result<EncodedTime<TargetScale, TargetFormat>>
+  checked_to_scale_format(const tempoch_context_t *ctx) const noexcept {
+    const Result<Time<S>> decoded = Time<S>::template checked_decode<F>(raw_.value(), ctx);
+    if (!decoded)
+      return decoded.error();
+    return decoded->template checked_scale_encode<TargetScale, TargetFormat>(ctx);
+  }
+
+  template <typename TargetFormat>
+  Result<EncodedTime<S, TargetFormat>> checked_to_format(const tempoch_context_t *ctx) const noexcept {
+    if constexpr (std::is_same_v<TargetFormat, F>) {
+      return *this;
+    } else if constexpr (detail::has_native_format_route_v<S, F, TargetFormat>) {
+      // JD → J2000 seconds can overflow a finite input.
+      const double out = detail::native_transcode<S, F, TargetFormat>(raw_.value());
+      if (!std::isfinite(out))
+        return Error{TEMPOCH_STATUS_T_CONVERSION_FAILED, "tempoch_time_to_format"};
+      return EncodedTime<S, TargetFormat>(out);
+    } else {
+      const Result<Time<S>> decoded = Time<S>::template checked_decode<F>(raw_.value(), ctx);
+      if (!decoded)
+        return decoded.error();
+      return decoded->template checked_encode<TargetFormat>(ctx);
     }
   }
 
+public:
   template <typename Q> EncodedTime operator+(const Q &delta) const {
     return (Time<S>::from_encoded(*this) + delta).template to<F>();
   }
@@ -423,17 +955,17 @@ public:
         .template to<quantity_type>();
   }
 
-  bool operator==(const EncodedTime &other) const noexcept { return raw_ == other.raw_; }
-  bool operator!=(const EncodedTime &other) const noexcept { return raw_ != other.raw_; }
-  bool operator<(const EncodedTime &other) const noexcept { return raw_ < other.raw_; }
-  bool operator<=(const EncodedTime &other) const noexcept { return raw_ <= other.raw_; }
-  bool operator>(const EncodedTime &other) const noexcept { return raw_ > other.raw_; }
-  bool operator>=(const EncodedTime &other) const noexcept { return raw_ >= other.raw_; }
+  constexpr bool operator==(const EncodedTime &other) const noexcept { return raw_ == other.raw_; }
+  constexpr bool operator!=(const EncodedTime &other) const noexcept { return raw_ != other.raw_; }
+  constexpr bool operator<(const EncodedTime &other) const noexcept { return raw_ < other.raw_; }
+  constexpr bool operator<=(const EncodedTime &other) const noexcept { return raw_ <= other.raw_; }
+  constexpr bool operator>(const EncodedTime &other) const noexcept { return raw_ > other.raw_; }
+  constexpr bool operator>=(const EncodedTime &other) const noexcept { return raw_ >= other.raw_; }
 
-  EncodedTime min(const EncodedTime &other) const noexcept {
+  constexpr EncodedTime min(const EncodedTime &other) const noexcept {
     return *this <= other ? *this : other;
   }
-  EncodedTime max(const EncodedTime &other) const noexcept {
+  constexpr EncodedTime max(const EncodedTime &other) const noexcept {
     return *this >= other ? *this : other;
   }
 
@@ -0,0 +1,421 @@
+#pragma once
+
+/**
+ * @file time_series.hpp
+ * @brief Memory-mapped binary files of `Time<S>` values.
+ *
+ * `write_time_series` stores a column of instants in the layout described in
+ * `docs/time_series_format.md`: a 64-byte header (scale tag, format tag,
+ * data-bundle fingerprint, counts), the split `{hi, lo}` records, and an
+ * optional per-block min / max zone map.  `MappedTimeSeries<S>` maps such a
+ * file read-only and exposes the records as `span<const Time<S>>` without
+ * copying them, so opening a file of any size costs one `mmap`.
+ *
+ * @code
+ * tempoch::write_time_series("epochs.tts", tempoch::span<const Time<scale::TT>>(epochs));
+ *
+ * auto file = tempoch::MappedTimeSeries<tempoch::scale::TT>::open("epochs.tts");
+ * file.for_each_block_overlapping(lo, hi, [&](std::size_t first, auto block) {
+ *   for (const auto &t : block) ...                       // only blocks whose zone overlaps
+ * });
+ * if (!file.matches_active_data())
+ *   std::cerr << "written under a different time-data bundle\n";
+ * @endcode
+ *
+ * This header is not part of `tempoch.hpp` because it pulls in the platform
+ * file-mapping headers (`<sys/mman.h>`, or `<windows.h>` on Windows).  Files
+ * are little-endian; both functions throw `TempochException` on big-endian
+ * hosts, I/O failures and malformed files.
+ */
+
+#include "data_status.hpp"
+#include "ffi_core.hpp"
+#include "span.hpp"
+#include "time_base.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace tempoch {
+
+/// File magic, the first eight bytes of every time-series file.
+inline constexpr char kTimeSeriesMagic[8] = {'T', 'E', 'M', 'P', 'O', 'T', 'S', '\0'};
+inline constexpr uint32_t kTimeSeriesVersion = 1;
+inline constexpr std::size_t kTimeSeriesHeaderSize = 64;
+
+/// Header flags.
+inline constexpr uint32_t kTimeSeriesHasZoneMaps = 1u << 0;
+inline constexpr uint32_t kTimeSeriesSorted = 1u << 1;
+
+struct TimeSeriesWriteOptions {
+  /// Records per zone-map block.
+  uint32_t block_size = 4'096;
+  /// Write the per-block min / max table.
+  bool zone_maps = true;
+};
+
+namespace detail {
+
+/// Decoded fixed header; see docs/time_series_format.md for the byte layout.
+struct TimeSeriesHeader {
+  int32_t scale_tag = 0;
+  int32_t format_tag = 0;
+  uint64_t fingerprint = 0;
+  uint64_t count = 0;
+  uint32_t block_size = 0;
+  uint32_t flags = 0;
+  uint64_t data_offset = 0;
+  uint64_t zone_map_offset = 0;
+};
+
+/// Per-block bounds as stored in the zone map.
+struct TimeSeriesZone {
+  tempoch_time_t min;
+  tempoch_time_t max;
+};
+
+template <typename S> inline void check_time_layout() {
+  static_assert(std::is_standard_layout_v<Time<S>> && std::is_trivially_copyable_v<Time<S>> &&
+                    sizeof(Time<S>) == sizeof(tempoch_time_t) &&
+                    alignof(Time<S>) == alignof(tempoch_time_t),
+                "Time<S> must have the layout of tempoch_time_t to be mapped in place");
+}
+
+inline void ensure_little_endian(const char *operation) {
+  const uint16_t probe = 1;
+  unsigned char first = 0;
+  std::memcpy(&first, &probe, 1);
+  if (first != 1)
+    throw TempochException(std::string(operation) + " failed: requires a little-endian host");
+}
+
+[[noreturn]] inline void time_series_error(const char *operation, const std::string &path,
+                                           const char *what) {
+  throw TempochException(std::string(operation) + " failed: " + path + ": " + what);
+}
+
+template <typename T> inline void put_field(unsigned char *header, std::size_t offset, T value) {
+  std::memcpy(header + offset, &value, sizeof value);
+}
+
+template <typename T> inline T get_field(const unsigned char *header, std::size_t offset) {
+  T value;
+  std::memcpy(&value, header + offset, sizeof value);
+  return value;
+}
+
+inline void encode_header(const TimeSeriesHeader &h, unsigned char *out) {
+  std::memset(out, 0, kTimeSeriesHeaderSize);
+  std::memcpy(out, kTimeSeriesMagic, sizeof kTimeSeriesMagic);
+  put_field<uint32_t>(out, 8, kTimeSeriesVersion);
+  put_field<uint32_t>(out, 12, static_cast<uint32_t>(kTimeSeriesHeaderSize));
+  put_field<int32_t>(out, 16, h.scale_tag);
+  put_field<int32_t>(out, 20, h.format_tag);
+  put_field<uint64_t>(out, 24, h.fingerprint);
+  put_field<uint64_t>(out, 32, h.count);
+  put_field<uint32_t>(out, 40, h.block_size);
+  put_field<uint32_t>(out, 44, h.flags);
+  put_field<uint64_t>(out, 48, h.data_offset);
+  put_field<uint64_t>(out, 56, h.zone_map_offset);
+}
+
+/// Decode and bounds-check a header against a file of @p file_size bytes; nullptr or a reason.
+inline const char *decode_header(const unsigned char *in, std::size_t file_size,
+                                 TimeSeriesHeader *h) {
+  if (file_size < kTimeSeriesHeaderSize ||
+      std::memcmp(in, kTimeSeriesMagic, sizeof kTimeSeriesMagic) != 0)
+    return "not a tempoch time-series file";
+  if (get_field<uint32_t>(in, 8) != kTimeSeriesVersion)
+    return "unsupported format version";
+  if (get_field<uint32_t>(in, 12) != kTimeSeriesHeaderSize)
+    return "unexpected header size";
+  h->scale_tag = get_field<int32_t>(in, 16);
+  h->format_tag = get_field<int32_t>(in, 20);
+  h->fingerprint = get_field<uint64_t>(in, 24);
+  h->count = get_field<uint64_t>(in, 32);
+  h->block_size = get_field<uint32_t>(in, 40);
+  h->flags = get_field<uint32_t>(in, 44);
+  h->data_offset = get_field<uint64_t>(in, 48);
+  h->zone_map_offset = get_field<uint64_t>(in, 56);
+
+  if (h->format_tag != static_cast<int32_t>(TEMPOCH_FORMAT_TAG_T_J2000_SECONDS))
+    return "records are not split J2000 seconds";
+  if (h->block_size == 0)
+    return "zero block size";
+  if (h->data_offset % alignof(tempoch_time_t) != 0 || h->data_offset > file_size ||
+      h->count > (file_size - h->data_offset) / sizeof(tempoch_time_t))
+    return "record block is truncated";
+  if (h->flags & kTimeSeriesHasZoneMaps) {
+    const uint64_t blocks = (h->count + h->block_size - 1) / h->block_size;
+    if (h->zone_map_offset % alignof(TimeSeriesZone) != 0 || h->zone_map_offset > file_size ||
+        blocks > (file_size - h->zone_map_offset) / sizeof(TimeSeriesZone))
+      return "zone map is truncated";
+  }
+  return nullptr;
+}
+
+/// Read-only mapping of a whole file; unmapped on destruction.
+class FileMapping {
+public:
+  FileMapping() = default;
+  FileMapping(const FileMapping &) = delete;
+  FileMapping &operator=(const FileMapping &) = delete;
+  FileMapping(FileMapping &&other) noexcept
+      : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {}
+  FileMapping &operator=(FileMapping &&other) noexcept {
+    if (this != &other) {
+      release();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+  ~FileMapping() { release(); }
+
+  /// Map @p path; returns nullptr on success or a static reason.
+  const char *open(const std::string &path) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+      return "cannot open file";
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+      CloseHandle(file);
+      return "cannot map an empty file";
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+      return "cannot map file";
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == nullptr)
+      return "cannot map file";
+    data_ = static_cast<const unsigned char *>(view);
+    size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+      return "cannot open file";
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+      ::close(fd);
+      return "cannot map an empty file";
+    }
+    const auto size = static_cast<std::size_t>(st.st_size);
+    void *view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED)
+      return "cannot map file";
+    data_ = static_cast<const unsigned char *>(view);
+    size_ = size;
+#endif
+    return nullptr;
+  }
+
+  const unsigned char *data() const noexcept { return data_; }
+  std::size_t size() const noexcept { return size_; }
+
+private:
+  const unsigned char *data_ = nullptr;
+  std::size_t size_ = 0;
+
+  void release() noexcept {
+    if (data_ == nullptr)
+      return;
+#if defined(_WIN32)
+    UnmapViewOfFile(data_);
+#else
+    ::munmap(const_cast<unsigned char *>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+  }
+};
+
+} // namespace detail
+
+/**
+ * @brief Write @p times to @p path in the tempoch time-series format.
+ *
+ * Records the active time-data fingerprint and, unless disabled, one min /
+ * max zone per `options.block_size` records.  The file is flagged as sorted
+ * when the values are non-decreasing, which enables `MappedTimeSeries::range`.
+ *
+ * @throws TempochException if the file cannot be written.
+ */
+template <typename S>
+inline void write_time_series(const std::string &path, span<const Time<S>> times,
+                              const TimeSeriesWriteOptions &options = {}) {
+  constexpr const char *kOperation = "tempoch::write_time_series";
+  detail::check_time_layout<S>();
+  detail::ensure_little_endian(kOperation);
+  if (options.block_size == 0)
+    detail::time_series_error(kOperation, path, "zero block size");
+
+  detail::TimeSeriesHeader header;
+  header.scale_tag = static_cast<int32_t>(scale_tag_v<S>);
+  header.format_tag = static_cast<int32_t>(TEMPOCH_FORMAT_TAG_T_J2000_SECONDS);
+  header.fingerprint = time_data_fingerprint();
+  header.count = times.size();
+  header.block_size = options.block_size;
+  header.data_offset = kTimeSeriesHeaderSize;
+  if (std::is_sorted(times.begin(), times.end()))
+    header.flags |= kTimeSeriesSorted;
+
+  std::vector<detail::TimeSeriesZone> zones;
+  if (options.zone_maps) {
+    header.flags |= kTimeSeriesHasZoneMaps;
+    header.zone_map_offset = header.data_offset + times.size() * sizeof(tempoch_time_t);
+    for (std::size_t first = 0; first < times.size(); first += options.block_size) {
+      const std::size_t last = std::min<std::size_t>(times.size(), first + options.block_size);
+      const auto bounds = std::minmax_element(times.begin() + first, times.begin() + last);
+      zones.push_back({bounds.first->c_inner(), bounds.second->c_inner()});
+    }
+  }
+
+  unsigned char bytes[kTimeSeriesHeaderSize];
+  detail::encode_header(header, bytes);
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out)
+    detail::time_series_error(kOperation, path, "cannot open file for writing");
+  out.write(reinterpret_cast<const char *>(bytes), sizeof bytes);
+  out.write(reinterpret_cast<const char *>(times.data()),
+            static_cast<std::streamsize>(times.size() * sizeof(tempoch_time_t)));
+  out.write(reinterpret_cast<const char *>(zones.data()),
+            static_cast<std::streamsize>(zones.size() * sizeof(detail::TimeSeriesZone)));
+  out.close();
+  if (!out)
+    detail::time_series_error(kOperation, path, "write failed");
+}
+
+/**
+ * @brief Read-only, zero-copy view of a time-series file on scale @p S.
+ *
+ * Move-only; the records stay mapped for the lifetime of the object, so the
+ * spans it hands out must not outlive it.
+ */
+template <typename S> class MappedTimeSeries {
+public:
+  /// Map @p path.
+  /// @throws TempochException if the file is missing, malformed or on another scale.
+  static MappedTimeSeries open(const std::string &path) {
+    constexpr const char *kOperation = "tempoch::MappedTimeSeries::open";
+    detail::check_time_layout<S>();
+    detail::ensure_little_endian(kOperation);
+    MappedTimeSeries file;
+    if (const char *reason = file.mapping_.open(path))
+      detail::time_series_error(kOperation, path, reason);
+    if (const char *reason =
+            detail::decode_header(file.mapping_.data(), file.mapping_.size(), &file.header_))
+      detail::time_series_error(kOperation, path, reason);
+    if (file.header_.scale_tag != static_cast<int32_t>(scale_tag_v<S>))
+      detail::time_series_error(kOperation, path, "file holds another time scale");
+    return file;
+  }
+
+  /// Every record, in file order.
+  span<const Time<S>> times() const noexcept {
+    return span<const Time<S>>(
+        reinterpret_cast<const Time<S> *>(mapping_.data() + header_.data_offset),
+        static_cast<std::size_t>(header_.count));
+  }
+
+  std::size_t size() const noexcept { return static_cast<std::size_t>(header_.count); }
+  bool empty() const noexcept { return header_.count == 0; }
+
+  /// Fingerprint of the time-data bundle active when the file was written.
+  uint64_t fingerprint() const noexcept { return header_.fingerprint; }
+
+  /// Whether the file was written under the currently active time-data bundle.
+  bool matches_active_data() const { return header_.fingerprint == time_data_fingerprint(); }
+
+  /// Whether the records are non-decreasing.
+  bool sorted() const noexcept { return (header_.flags & kTimeSeriesSorted) != 0; }
+  bool has_zone_maps() const noexcept { return (header_.flags & kTimeSeriesHasZoneMaps) != 0; }
+
+  std::size_t block_size() const noexcept { return header_.block_size; }
+  std::size_t block_count() const noexcept {
+    return (size() + block_size() - 1) / block_size();
+  }
+
+  /// Records of block @p i.
+  span<const Time<S>> block(std::size_t i) const noexcept {
+    const std::size_t first = i * block_size();
+    return times().subspan(first, std::min(block_size(), size() - first));
+  }
+
+  /// Smallest and largest record of block @p i, from the zone map.
+  /// @throws TempochException if the file has no zone map.
+  std::pair<Time<S>, Time<S>> block_bounds(std::size_t i) const {
+    if (!has_zone_maps())
+      throw TempochException("tempoch::MappedTimeSeries::block_bounds failed: no zone map");
+    const detail::TimeSeriesZone &zone = zones()[i];
+    return {Time<S>::from_c(zone.min), Time<S>::from_c(zone.max)};
+  }
+
+  /**
+   * Call `fn(first_index, block)` for every block that may hold a record in
+   * `[lo, hi)`.  Blocks whose zone lies outside the range are skipped without
+   * touching their records; without a zone map every block is visited.
+   */
+  template <typename Fn>
+  void for_each_block_overlapping(const Time<S> &lo, const Time<S> &hi, Fn &&fn) const {
+    for (std::size_t i = 0; i < block_count(); ++i) {
+      if (has_zone_maps()) {
+        const detail::TimeSeriesZone &zone = zones()[i];
+        if (Time<S>::from_c(zone.max) < lo || !(Time<S>::from_c(zone.min) < hi))
+          continue;
+      }
+      fn(i * block_size(), block(i));
+    }
+  }
+
+  /// The records in `[lo, hi)` of a sorted file, found by binary search.
+  /// @throws TempochException if the file is not flagged as sorted.
+  span<const Time<S>> range(const Time<S> &lo, const Time<S> &hi) const {
+    if (!sorted())
+      throw TempochException("tempoch::MappedTimeSeries::range failed: file is not sorted");
+    const span<const Time<S>> all = times();
+    const auto first = std::lower_bound(all.begin(), all.end(), lo);
+    const auto last = std::lower_bound(first, all.end(), hi);
+    return all.subspan(static_cast<std::size_t>(first - all.begin()),
+                       static_cast<std::size_t>(last - first));
+  }
+
+private:
+  detail::FileMapping mapping_;
+  detail::TimeSeriesHeader header_;
+
+  MappedTimeSeries() = default;
+
+  const detail::TimeSeriesZone *zones() const noexcept {
+    return reinterpret_cast<const detail::TimeSeriesZone *>(mapping_.data() +
+                                                            header_.zone_map_offset);
+  }
+};
+
+} // namespace tempoch
@@ -0,0 +1,267 @@
+#pragma once
+
+/**
+ * @file to_chars.hpp
+ * @brief Locale-free text formatting into caller buffers.
+ *
+ * The `to_chars` overloads follow `std::to_chars`: they write into
+ * `[first, last)` and return `{end, std::errc{}}`, or `{last,
+ * std::errc::value_too_large}` when the range is too small.  They never touch
+ * the locale or the heap, so an exporter can format into one reused buffer.
+ *
+ * @code
+ * char buf[tempoch::kIso8601MaxChars];
+ * auto [end, ec] = tempoch::to_chars(buf, buf + sizeof buf, civil, 3);  // ...T22:00:00.250Z
+ * auto mjd = utc.to<tempoch::scale::TT>().to<tempoch::format::MJD>();
+ * std::tie(end, ec) = tempoch::to_chars(buf, buf + sizeof buf, mjd, 9); // 61236.917467407
+ * @endcode
+ *
+ * `to_chars_column` writes a whole column, one delimited record per value,
+ * into a contiguous text buffer.  A `Time<UTC>` column reuses the resolved
+ * UTC day like the span overload of `to_civil`, so time-sorted input costs one
+ * tempoch-ffi call per day.
+ *
+ * Invalid arguments (a precision out of range, a non-finite value, an instant
+ * UTC cannot label) are reported as `std::errc::invalid_argument`.
+ */
+
+#include "batch.hpp"
+#include "civil_time.hpp"
+#include "gnss_week.hpp"
+#include "span.hpp"
+#include "time_base.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+namespace tempoch {
+
+/// Longest `to_chars(CivilTime)` output: `-2147483648-12-31T23:59:60.999999999Z`.
+inline constexpr std::size_t kIso8601MaxChars = 37;
+/// Longest fixed-point `to_chars(EncodedTime)` output at `kMaxFixedPrecision`.
+inline constexpr std::size_t kFixedDecimalMaxChars = 37;
+/// Longest `to_chars(GnssWeek)` output: `4294967295 604799.999999999`.
+inline constexpr std::size_t kGnssWeekMaxChars = 27;
+/// Most fractional digits `to_chars(EncodedTime)` accepts.
+inline constexpr int kMaxFixedPrecision = 15;
+
+namespace detail {
+
+inline constexpr uint64_t kPow10[16] = {1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull,
+                                        1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+                                        10000000000ull, 100000000000ull, 1000000000000ull,
+                                        10000000000000ull, 100000000000000ull, 1000000000000000ull};
+
+inline int decimal_digits(uint64_t v) noexcept {
+  int n = 1;
+  for (; v >= 10; v /= 10)
+    ++n;
+  return n;
+}
+
+/// Write @p v zero-padded to @p width digits (more if it needs them); returns the new end.
+inline char *put_decimal(char *p, uint64_t v, int width) noexcept {
+  const int n = v < kPow10[width] ? width : decimal_digits(v);
+  for (int i = n - 1; i >= 0; --i, v /= 10)
+    p[i] = static_cast<char>('0' + v % 10);
+  return p + n;
+}
+
+inline std::to_chars_result too_large(char *last) noexcept {
+  return {last, std::errc::value_too_large};
+}
+
+inline std::to_chars_result invalid(char *first) noexcept {
+  return {first, std::errc::invalid_argument};
+}
+
+/// Whether every field of @p c has its nominal width; `CivilTime` itself is not validated.
+inline bool civil_fields_printable(const CivilTime &c) noexcept {
+  return c.month >= 1 && c.month <= 12 && c.day >= 1 && c.day <= 31 && c.hour <= 23 &&
+         c.minute <= 59 && c.second <= 60 && c.nanosecond < 1'000'000'000u;
+}
+
+inline std::to_chars_result civil_to_chars(char *first, char *last, const CivilTime &c,
+                                           int precision) noexcept {
+  if (precision < 0 || precision > 9 || !civil_fields_printable(c))
+    return invalid(first);
+  const bool extended = c.year < 0 || c.year > 9'999;
+  const uint64_t year = c.year < 0 ? 0ull - static_cast<uint64_t>(static_cast<int64_t>(c.year))
+                                   : static_cast<uint64_t>(c.year);
+  const int year_digits = std::max(4, decimal_digits(year));
+  const std::size_t size = static_cast<std::size_t>((extended ? 1 : 0) + year_digits + 16 +
+                                                    (precision > 0 ? 1 + precision : 0));
+  if (static_cast<std::size_t>(last - first) < size)
+    return too_large(last);
+  char *p = first;
+  if (extended)
+    *p++ = c.year < 0 ? '-' : '+';
+  p = put_decimal(p, year, 4);
+  *p++ = '-';
+  p = put_decimal(p, c.month, 2);
+  *p++ = '-';
+  p = put_decimal(p, c.day, 2);
+  *p++ = 'T';
+  p = put_decimal(p, c.hour, 2);
+  *p++ = ':';
+  p = put_decimal(p, c.minute, 2);
+  *p++ = ':';
+  p = put_decimal(p, c.second, 2);
+  if (precision > 0) {
+    *p++ = '.';
+    p = put_decimal(p, c.nanosecond / kPow10[9 - precision], precision);
+  }
+  *p++ = 'Z';
+  return {p, std::errc{}};
+}
+
+/// Fixed-point decimal of @p value, rounded half away from zero to @p precision digits.
+inline std::to_chars_result fixed_to_chars(char *first, char *last, double value,
+                                           int precision) noexcept {
+  if (precision < 0 || precision > kMaxFixedPrecision || !std::isfinite(value) ||
+      !(std::fabs(value) < 1.0e19))
+    return invalid(first);
+  const double magnitude = std::fabs(value);
+  uint64_t whole = static_cast<uint64_t>(magnitude);
+  const double scale = static_cast<double>(kPow10[precision]);
+  uint64_t fraction =
+      static_cast<uint64_t>(std::llround((magnitude - static_cast<double>(whole)) * scale));
+  if (fraction >= kPow10[precision]) {
+    fraction -= kPow10[precision];
+    ++whole;
+  }
+  const bool negative = std::signbit(value) && (whole != 0 || fraction != 0);
+  const std::size_t size = static_cast<std::size_t>((negative ? 1 : 0) + decimal_digits(whole) +
+                                                    (precision > 0 ? 1 + precision : 0));
+  if (static_cast<std::size_t>(last - first) < size)
+    return too_large(last);
+  char *p = first;
+  if (negative)
+    *p++ = '-';
+  p = put_decimal(p, whole, 1);
+  if (precision > 0) {
+    *p++ = '.';
+    p = put_decimal(p, fraction, precision);
+  }
+  return {p, std::errc{}};
+}
+
+/// Run @p write for every value, each record followed by @p delimiter.
+template <typename T, typename Write>
+inline std::to_chars_result column_to_chars(char *first, char *last, span<const T> values,
+                                            char delimiter, const Write &write) {
+  char *p = first;
+  for (const T &value : values) {
+    const std::to_chars_result r = write(p, last, value);
+    if (r.ec != std::errc{})
+      return r;
+    if (r.ptr == last)
+      return too_large(last);
+    p = r.ptr;
+    *p++ = delimiter;
+  }
+  return {p, std::errc{}};
+}
+
+} // namespace detail
+
+// -- Scalars -------------------------------------------------------------------
+
+/// ISO 8601 `YYYY-MM-DDThh:mm:ss[.f]Z` with @p precision (0-9) fractional digits, truncated.
+/// Years outside [0, 9999] are written in the expanded `±Y...` form; a field outside its
+/// civil range (month 13, nanosecond 1e9, ...) is `invalid_argument`.
+inline std::to_chars_result to_chars(char *first, char *last, const CivilTime &civil,
+                                     int precision = 9) noexcept {
+  return detail::civil_to_chars(first, last, civil, precision);
+}
+
+/// ISO 8601 label of a UTC instant; `invalid_argument` if it has no civil label.
+inline std::to_chars_result to_chars(char *first, char *last, const Time<scale::UTC> &time,
+                                     int precision = 9) noexcept {
+  CivilTime civil;
+  if (detail::try_time_to_civil(time.c_inner(), nullptr, &civil) != TEMPOCH_STATUS_T_OK)
+    return detail::invalid(first);
+  return detail::civil_to_chars(first, last, civil, precision);
+}
+
+/// The encoded value (JD, MJD, Unix seconds, ...) in fixed notation with @p precision
+/// (0-15) fractional digits, e.g. `2460000.500000`.
+template <typename S, typename F>
+inline std::to_chars_result to_chars(char *first, char *last, const EncodedTime<S, F> &time,
+                                     int precision) noexcept {
+  return detail::fixed_to_chars(first, last, static_cast<double>(time.raw().value()), precision);
+}
+
+/// `<week> <seconds of week>[.f]`, seconds zero-padded to six digits and @p precision (0-9)
+/// fractional digits truncated, e.g. `2345 003600.500`.  Seconds of week of 604800 or
+/// more, or subsecond nanoseconds of 1e9 or more, are `invalid_argument`.
+inline std::to_chars_result to_chars(char *first, char *last, const GnssWeek &gw,
+                                     int precision = 9) noexcept {
+  if (precision < 0 || precision > 9 || gw.seconds_of_week >= 604'800u ||
+      gw.subsecond_nanos >= 1'000'000'000u)
+    return detail::invalid(first);
+  const std::size_t size = static_cast<std::size_t>(detail::decimal_digits(gw.week) + 1 + 6 +
+                                                    (precision > 0 ? 1 + precision : 0));
+  if (static_cast<std::size_t>(last - first) < size)
+    return detail::too_large(last);
+  char *p = detail::put_decimal(first, gw.week, 1);
+  *p++ = ' ';
+  p = detail::put_decimal(p, gw.seconds_of_week, 6);
+  if (precision > 0) {
+    *p++ = '.';
+    p = detail::put_decimal(p, gw.subsecond_nanos / detail::kPow10[9 - precision], precision);
+  }
+  return {p, std::errc{}};
+}
+
+// -- Columns -------------------------------------------------------------------
+
+/// Write every civil label, each followed by @p delimiter.
+inline std::to_chars_result to_chars_column(char *first, char *last, span<const CivilTime> values,
+                                            int precision = 9, char delimiter = '\n') noexcept {
+  return detail::column_to_chars(first, last, values, delimiter,
+                                 [precision](char *f, char *l, const CivilTime &c) {
+                                   return detail::civil_to_chars(f, l, c, precision);
+                                 });
+}
+
+/// ISO 8601 column of UTC instants, resolving each UTC day once for sorted input.
+inline std::to_chars_result to_chars_column(char *first, char *last,
+                                            span<const Time<scale::UTC>> values,
+                                            int precision = 9, char delimiter = '\n') noexcept {
+  detail::CivilDayAnchor anchor;
+  return detail::column_to_chars(
+      first, last, values, delimiter,
+      [precision, &anchor](char *f, char *l, const Time<scale::UTC> &t) {
+        CivilTime civil;
+        if (detail::to_civil_cached(t.c_inner(), nullptr, anchor, &civil) != TEMPOCH_STATUS_T_OK)
+          return detail::invalid(f);
+        return detail::civil_to_chars(f, l, civil, precision);
+      });
+}
+
+/// Fixed-point column of encoded values.
+template <typename S, typename F>
+inline std::to_chars_result to_chars_column(char *first, char *last,
+                                            span<const EncodedTime<S, F>> values, int precision,
+                                            char delimiter = '\n') noexcept {
+  return detail::column_to_chars(first, last, values, delimiter,
+                                 [precision](char *f, char *l, const EncodedTime<S, F> &t) {
+                                   return to_chars(f, l, t, precision);
+                                 });
+}
+
+/// GNSS week column.
+inline std::to_chars_result to_chars_column(char *first, char *last, span<const GnssWeek> values,
+                                            int precision = 9, char delimiter = '\n') noexcept {
+  return detail::column_to_chars(first, last, values, delimiter,
+                                 [precision](char *f, char *l, const GnssWeek &gw) {
+                                   return to_chars(f, l, gw, precision);
+                                 });
+}
+
+} // namespace tempoch
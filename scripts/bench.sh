@@ -0,0 +1,82 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+# shellcheck source=scripts/lib.sh
+source "${SCRIPT_DIR}/lib.sh"
+
+BUILD_DIR="build-bench"
+OUT_FILE=""
+FILTER="."
+REPETITIONS="1"
+PARALLEL_LEVEL="${CMAKE_BUILD_PARALLEL_LEVEL:-2}"
+
+usage() {
+  cat <<EOF
+Usage: $(basename "$0") [--build-dir DIR] [--out FILE] [--filter REGEX] [--repetitions N] [--parallel N]
+
+Builds bench_tempoch in Release mode and writes Google Benchmark JSON results
+to FILE (default: bench-results/<git describe>.json).
+EOF
+}
+
+while [[ $# -gt 0 ]]; do
+  case "$1" in
+    --build-dir)
+      BUILD_DIR="$2"
+      shift 2
+      ;;
+    --out)
+      OUT_FILE="$2"
+      shift 2
+      ;;
+    --filter)
+      FILTER="$2"
+      shift 2
+      ;;
+    --repetitions)
+      REPETITIONS="$2"
+      shift 2
+      ;;
+    --parallel)
+      PARALLEL_LEVEL="$2"
+      shift 2
+      ;;
+    --help|-h)
+      usage
+      exit 0
+      ;;
+    *)
+      fail "Unknown argument: $1"
+      usage
+      exit 1
+      ;;
+  esac
+done
+
+ensure_repo_root
+require_cmd cmake
+require_cmd ninja
+
+if [[ -z "${OUT_FILE}" ]]; then
+  OUT_FILE="bench-results/$(git describe --tags --always --dirty 2>/dev/null || echo local).json"
+fi
+mkdir -p "$(dirname "${OUT_FILE}")"
+
+header "Configure: CMake (${BUILD_DIR})"
+ensure_fresh_cmake_build_dir "${BUILD_DIR}" "${REPO_ROOT}"
+cmake -S . -B "${BUILD_DIR}" -G Ninja \
+  -DCMAKE_BUILD_TYPE=Release \
+  -DTEMPOCH_BUILD_DOCS=OFF \
+  -DTEMPOCH_BUILD_BENCHMARKS=ON
+
+header "Build: bench_tempoch"
+CMAKE_BUILD_PARALLEL_LEVEL="${PARALLEL_LEVEL}" cmake --build "${BUILD_DIR}" --target bench_tempoch
+
+header "Run: bench_tempoch -> ${OUT_FILE}"
+"${BUILD_DIR}/bench_tempoch" \
+  --benchmark_filter="${FILTER}" \
+  --benchmark_repetitions="${REPETITIONS}" \
+  --benchmark_out="${OUT_FILE}" \
+  --benchmark_out_format=json
+ok "Benchmark results written to ${OUT_FILE}"
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// A translation unit built with the FFI call counters off, linked next to
+// test_ffi_stats.cpp to check that mixed TEMPOCH_FFI_STATS settings are safe.
+
+#undef TEMPOCH_FFI_STATS
+#define TEMPOCH_FFI_STATS 0
+#include <tempoch/tempoch.hpp>
+
+namespace ffi_stats_test {
+
+bool plain_tu_counts_calls() { return tempoch::kFfiStatsEnabled; }
+
+double plain_tu_tt_to_tdb(double jd_tt) {
+  using namespace tempoch;
+  return EncodedTime<scale::TT, format::JD>(jd_tt).to<scale::TDB, format::JD>().value();
+}
+
+} // namespace ffi_stats_test
@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for the Arrow C Data Interface export / import.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+using Mjd = EncodedTime<scale::TT, format::MJD>;
+using Utc = Time<scale::UTC>;
+
+int g_released = 0;
+
+/// A producer-side primitive column over caller buffers that counts its releases.
+struct ForeignColumn {
+  std::string format;
+  std::string metadata;
+  const void *buffers[2] = {nullptr, nullptr};
+
+  void make(ArrowSchema *schema, ArrowArray *array, const void *values, int64_t length,
+            const uint8_t *validity = nullptr, int64_t null_count = 0, int64_t offset = 0) {
+    buffers[0] = validity;
+    buffers[1] = values;
+    *schema = ArrowSchema{};
+    schema->format = format.c_str();
+    schema->name = "";
+    schema->metadata = metadata.empty() ? nullptr : metadata.data();
+    schema->release = [](ArrowSchema *s) {
+      ++g_released;
+      s->release = nullptr;
+    };
+    *array = ArrowArray{};
+    array->length = length;
+    array->null_count = null_count;
+    array->offset = offset;
+    array->n_buffers = 2;
+    array->buffers = buffers;
+    array->release = [](ArrowArray *a) {
+      ++g_released;
+      a->release = nullptr;
+    };
+  }
+};
+
+std::vector<Mjd> mjd_column(std::size_t n) {
+  std::vector<Mjd> out;
+  for (std::size_t i = 0; i < n; ++i)
+    out.emplace_back(61'000.0 + 0.25 * static_cast<double>(i));
+  return out;
+}
+
+} // namespace
+
+TEST(Arrow, EncodedColumnsCrossWithoutCopying) {
+  auto values = mjd_column(100);
+  const Mjd *buffer = values.data();
+  ArrowSchema schema;
+  ArrowArray array;
+  export_arrow(std::move(values), &schema, &array, "epoch");
+
+  EXPECT_STREQ(schema.format, "g");
+  EXPECT_STREQ(schema.name, "epoch");
+  EXPECT_EQ(detail::find_arrow_metadata(schema.metadata, kArrowScaleKey), "TT");
+  EXPECT_EQ(detail::find_arrow_metadata(schema.metadata, kArrowFormatKey), "MJD");
+  EXPECT_EQ(array.length, 100);
+  EXPECT_EQ(array.null_count, 0);
+  EXPECT_EQ(array.buffers[1], static_cast<const void *>(buffer));
+
+  {
+    const auto column = import_arrow<scale::TT, format::MJD>(&schema, &array);
+    EXPECT_EQ(schema.release, nullptr);
+    EXPECT_EQ(array.release, nullptr);
+    ASSERT_EQ(column.size(), 100u);
+    EXPECT_EQ(column.values().data(), buffer);
+    EXPECT_EQ(column.values()[4].value(), 61'001.0);
+    EXPECT_TRUE(column.is_valid(99));
+
+    const auto decoded = column.decode();
+    EXPECT_TRUE(decoded.status.all_ok());
+    EXPECT_EQ(decoded[8].to<format::MJD>().value(), 61'002.0);
+  }
+
+  // A borrowed view exports the caller's buffer and frees only its own bookkeeping.
+  const auto kept = mjd_column(10);
+  export_arrow_view(span<const Mjd>(kept), &schema, &array);
+  EXPECT_EQ(array.buffers[1], static_cast<const void *>(kept.data()));
+  schema.release(&schema);
+  array.release(&array);
+  EXPECT_EQ(schema.release, nullptr);
+  EXPECT_EQ(array.release, nullptr);
+}
+
+TEST(Arrow, ImportChecksTagsAndReleasesOnFailure) {
+  const std::vector<double> raw = {61'000.0, 61'000.5, 61'001.0, 61'001.5, 61'002.0};
+  ForeignColumn producer{"g", detail::arrow_metadata("TT", "JD")};
+  ArrowSchema schema;
+  ArrowArray array;
+
+  g_released = 0;
+  producer.make(&schema, &array, raw.data(), 5);
+  EXPECT_THROW((import_arrow<scale::TT, format::MJD>(&schema, &array)), TempochException);
+  EXPECT_EQ(g_released, 2);
+  EXPECT_EQ(schema.release, nullptr);
+
+  producer.metadata.clear(); // untagged float64 columns are not guessed
+  producer.make(&schema, &array, raw.data(), 5);
+  EXPECT_THROW((import_arrow<scale::TT, format::MJD>(&schema, &array)), TempochException);
+
+  producer = ForeignColumn{"l", detail::arrow_metadata("TT", "MJD")};
+  producer.make(&schema, &array, raw.data(), 5);
+  EXPECT_THROW((import_arrow<scale::TT, format::MJD>(&schema, &array)), TempochException);
+
+  // Sliced column with nulls: slots 1 and 3 of the slice are null.
+  producer = ForeignColumn{"g", detail::arrow_metadata("TT", "MJD")};
+  const uint8_t validity[] = {0b0000'1011}; // raw slots 2 and 4 are null
+  producer.make(&schema, &array, raw.data(), 4, validity, 2, 1);
+  g_released = 0;
+  {
+    const auto column = import_arrow<scale::TT, format::MJD>(&schema, &array);
+    ASSERT_EQ(column.size(), 4u);
+    EXPECT_EQ(column.raw()[0], 61'000.5);
+    EXPECT_TRUE(column.is_valid(0));
+    EXPECT_FALSE(column.is_valid(1));
+    EXPECT_TRUE(column.is_valid(2));
+    EXPECT_FALSE(column.is_valid(3));
+
+    const auto decoded = column.decode();
+    EXPECT_EQ(decoded.status.failed(), 2u);
+    EXPECT_EQ(decoded.status.status(3), TEMPOCH_STATUS_T_NULL_POINTER);
+    EXPECT_EQ(decoded[2].to<format::MJD>().value(), 61'001.5);
+  }
+  EXPECT_EQ(g_released, 2);
+}
+
+TEST(Arrow, MetadataScanStopsAtTheFirstMalformedEntry) {
+  const auto put_int = [](std::string &out, int32_t v) {
+    out.append(reinterpret_cast<const char *>(&v), sizeof v);
+  };
+  const auto put_string = [&](std::string &out, const std::string &s) {
+    put_int(out, static_cast<int32_t>(s.size()));
+    out += s;
+  };
+  const std::string tagged = detail::arrow_metadata("TT", "MJD");
+
+  for (int32_t bad_size : {-1, INT32_MIN, INT32_MAX}) {
+    std::string metadata;
+    put_int(metadata, 2);
+    put_int(metadata, bad_size); // malformed first key
+    put_string(metadata, std::string(kArrowScaleKey));
+    put_string(metadata, "TT");
+    EXPECT_EQ(detail::find_arrow_metadata(metadata.data(), kArrowScaleKey), std::nullopt)
+        << bad_size;
+  }
+
+  std::string bad_value;
+  put_int(bad_value, 2);
+  put_string(bad_value, "other");
+  put_int(bad_value, -4);
+  bad_value += tagged.substr(sizeof(int32_t));
+  EXPECT_EQ(detail::find_arrow_metadata(bad_value.data(), kArrowScaleKey), std::nullopt);
+
+  std::string negative_pairs;
+  put_int(negative_pairs, -1);
+  EXPECT_EQ(detail::find_arrow_metadata(negative_pairs.data(), kArrowScaleKey), std::nullopt);
+  EXPECT_EQ(detail::find_arrow_metadata(tagged.data(), kArrowFormatKey), "MJD");
+}
+
+TEST(Arrow, NullNameExportsAsEmpty) {
+  ArrowSchema schema;
+  ArrowArray array;
+  export_arrow(mjd_column(3), &schema, &array, nullptr);
+  EXPECT_STREQ(schema.name, "");
+  schema.release(&schema);
+  array.release(&array);
+}
+
+TEST(Arrow, TimestampsRoundTripToTheNanosecond) {
+  const std::vector<Utc> utc = {
+      Utc::unix_epoch(),
+      Utc::from_split_seconds(qtty::Second(8.0e8), qtty::Second(0.123'456'789)),
+      Utc::from_split_seconds(qtty::Second(8.0e8 + 0.5)),
+      Utc::from_split_seconds(qtty::Second(-1.0e9 - 0.25)),
+  };
+  ArrowSchema schema;
+  ArrowArray array;
+  export_arrow_timestamps(span<const Utc>(utc), &schema, &array, "stamp");
+  EXPECT_STREQ(schema.format, "tsn:UTC");
+  ASSERT_EQ(array.length, 4);
+
+  const auto *nanos = static_cast<const int64_t *>(array.buffers[1]);
+  const auto unix_seconds = encode_column<scale::UTC, format::Unix>(span<const Utc>(utc));
+  EXPECT_EQ(nanos[0], 0);
+  for (std::size_t i = 0; i < utc.size(); ++i)
+    EXPECT_NEAR(static_cast<double>(nanos[i]) * 1.0e-9, unix_seconds[i], 1.0e-6) << i;
+  EXPECT_EQ(nanos[2] - nanos[1], 376'543'211);
+  EXPECT_EQ(nanos[3] % 1'000'000'000, -250'000'000);
+
+  const auto back = import_arrow_timestamps<scale::UTC>(&schema, &array);
+  ASSERT_TRUE(back.status.all_ok());
+  for (std::size_t i = 0; i < utc.size(); ++i)
+    EXPECT_NEAR((back[i] - utc[i]).value(), 0.0, 1.0e-9) << i;
+
+  // Microsecond UTC columns from other engines.
+  const int64_t micros[] = {1'500'000, -1};
+  ForeignColumn producer{"tsu:UTC", ""};
+  producer.make(&schema, &array, micros, 2);
+  const auto us = import_arrow_timestamps<scale::UTC>(&schema, &array);
+  EXPECT_NEAR((us[0] - Utc::unix_epoch()).value(), 1.5, 1.0e-12);
+  EXPECT_NEAR((us[1] - Utc::unix_epoch()).value(), -1.0e-6, 1.0e-12);
+}
+
+TEST(Arrow, TaiTimestampsAreTaggedAndChecked) {
+  using Tai = Time<scale::TAI>;
+  const std::vector<Tai> tai = {Tai::from_split_seconds(qtty::Second(-946'728'000.0 + 2.0)),
+                                Tai::from_split_seconds(qtty::Second(7.0e8), qtty::Second(1e-9))};
+  ArrowSchema schema;
+  ArrowArray array;
+  export_arrow_timestamps(span<const Tai>(tai), &schema, &array);
+  EXPECT_STREQ(schema.format, "tsn:");
+  EXPECT_EQ(detail::find_arrow_metadata(schema.metadata, kArrowScaleKey), "TAI");
+  const auto *nanos = static_cast<const int64_t *>(array.buffers[1]);
+  EXPECT_EQ(nanos[0], 2'000'000'000);
+  EXPECT_EQ(nanos[1], 1'646'728'000'000'000'001);
+
+  // A TAI column is not a UTC column, and vice versa.
+  EXPECT_THROW(import_arrow_timestamps<scale::UTC>(&schema, &array), TempochException);
+  const int64_t plain[] = {0};
+  ForeignColumn producer{"tsn:", ""};
+  producer.make(&schema, &array, plain, 1);
+  EXPECT_THROW(import_arrow_timestamps<scale::TAI>(&schema, &array), TempochException);
+
+  export_arrow_timestamps(span<const Tai>(tai), &schema, &array);
+  const auto back = import_arrow_timestamps<scale::TAI>(&schema, &array);
+  ASSERT_TRUE(back.status.all_ok());
+  EXPECT_EQ(back[0], tai[0]);
+  EXPECT_EQ(back[1], tai[1]);
+
+  const std::vector<Tai> far = {Tai::from_split_seconds(qtty::Second(1.0e10))};
+  EXPECT_THROW(export_arrow_timestamps(span<const Tai>(far), &schema, &array), TempochException);
+}
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for pre-resolved ConversionPlan routes.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <cmath>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+using UnixToTtJd = ConversionPlan<scale::UTC, format::Unix, scale::TT, format::JD>;
+using TtJdToMjd = ConversionPlan<scale::TT, format::JD, scale::TT, format::MJD>;
+using TaiToTt = ConversionPlan<scale::TAI, void, scale::TT, void>;
+using TtToUt1 = ConversionPlan<scale::TT, void, scale::UT1, void>;
+using GpsToTtSeconds = ConversionPlan<scale::TAI, format::GPS, scale::TT, format::J2000s>;
+
+static_assert(TtJdToMjd::direct_transcode && TtJdToMjd::fully_native);
+static_assert(TaiToTt::fully_native && !TaiToTt::direct_transcode);
+static_assert(!UnixToTtJd::fully_native && !UnixToTtJd::native_decode);
+static_assert(UnixToTtJd::native_scale == false);
+static_assert(GpsToTtSeconds::fully_native);
+static_assert(std::is_same_v<UnixToTtJd::input_type, UnixTime>);
+static_assert(std::is_same_v<TaiToTt::output_type, Time<scale::TT>>);
+static_assert(!std::is_default_constructible_v<TtToUt1>);
+
+std::vector<double> unix_samples() {
+  std::vector<double> out;
+  for (int day = 0; day < 40; ++day)
+    out.push_back(1'600'000'000.0 + day * 86'400.0 * 37.25);
+  return out;
+}
+
+} // namespace
+
+TEST(ConversionPlan, ScalarMatchesChainedConversion) {
+  const UnixToTtJd plan;
+  for (double unix_s : unix_samples()) {
+    const UnixTime in(unix_s);
+    const auto expected = Time<scale::UTC>::from_encoded(in).to<scale::TT, format::JD>();
+    EXPECT_EQ(plan(in), expected);
+  }
+}
+
+TEST(ConversionPlan, ColumnMatchesScalarCalls) {
+  const UnixToTtJd plan;
+  const auto unix_s = unix_samples();
+  std::vector<double> jd(unix_s.size());
+
+  const BatchStatus status = plan(unix_s, jd);
+
+  EXPECT_TRUE(status.all_ok());
+  for (std::size_t i = 0; i < unix_s.size(); ++i)
+    EXPECT_EQ(jd[i], plan(UnixTime(unix_s[i])).value());
+}
+
+TEST(ConversionPlan, NativeRoutesStayExact) {
+  const TtJdToMjd transcode;
+  const auto jd = JulianDate<scale::TT>(2'460'000.25);
+  EXPECT_EQ(transcode(jd), jd.to<format::MJD>());
+
+  const TaiToTt split;
+  const auto tai = Time<scale::TAI>::from_split_seconds(qtty::Second(8.0e8), qtty::Second(1.0e-7));
+  EXPECT_EQ(split(tai), tai.to<scale::TT>());
+}
+
+TEST(ConversionPlan, ColumnReportsFailuresAsNaN) {
+  const UnixToTtJd plan;
+  std::vector<double> in{1'600'000'000.0, std::nan(""), 1'700'000'000.0};
+  std::vector<double> out(in.size());
+
+  const BatchStatus status = plan(in, out);
+
+  EXPECT_EQ(status.failed(), 1u);
+  EXPECT_EQ(status.first_failure(), 1u);
+  EXPECT_TRUE(std::isnan(out[1]));
+  EXPECT_FALSE(std::isnan(out[2]));
+}
+
+TEST(ConversionPlan, PinnedContextAndCheckedFailure) {
+  const TtToUt1 plan(TimeContext::with_builtin_eop());
+  const auto inside = Time<scale::TT>::from_encoded(JulianDate<scale::TT>(2'460'000.5));
+  const auto outside = Time<scale::TT>::from_encoded(JulianDate<scale::TT>(2'500'000.0));
+
+  EXPECT_EQ(plan(inside), inside.to_with<scale::UT1>(TimeContext::with_builtin_eop()));
+
+  const Result<Time<scale::UT1>> failed = plan.checked(outside);
+  ASSERT_FALSE(failed.ok());
+  EXPECT_STREQ(failed.error().operation, "tempoch_time_scale_convert");
+  EXPECT_ANY_THROW(plan(outside));
+
+  std::vector<Time<scale::TT>> in{inside, outside};
+  std::vector<Time<scale::UT1>> out(in.size());
+  const auto untouched = out[1];
+  const BatchStatus status = plan(in, out);
+  EXPECT_TRUE(status.ok(0));
+  EXPECT_FALSE(status.ok(1));
+  EXPECT_EQ(out[1], untouched);
+}
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for the opt-in tempoch-ffi call counters.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace tempoch;
+
+namespace ffi_stats_test {
+bool plain_tu_counts_calls();
+double plain_tu_tt_to_tdb(double jd_tt);
+} // namespace ffi_stats_test
+
+TEST(FfiStats, EntryNamesMatchTheCSymbols) {
+  EXPECT_STREQ(ffi_entry_name(FfiEntry::tempoch_time_scale_convert), "tempoch_time_scale_convert");
+  EXPECT_STREQ(ffi_entry_name(FfiEntry::tempoch_time_to_gnss_week), "tempoch_time_to_gnss_week");
+  EXPECT_STREQ(ffi_entry_name(static_cast<FfiEntry>(kFfiEntryCount)), "unknown");
+}
+
+TEST(FfiStats, DisabledBuildsReportNothing) {
+  if (kFfiStatsEnabled)
+    GTEST_SKIP() << "built with TEMPOCH_FFI_STATS=1";
+  (void)Time<scale::UTC>::from_civil({2026, 3, 1, 0, 0, 0}).to<scale::TDB>();
+  EXPECT_EQ(ffi_stats_thread().total_calls(), 0u);
+  EXPECT_EQ(ffi_stats().total_calls(), 0u);
+}
+
+TEST(FfiStats, CountsCallsPerEntryPoint) {
+  if (!kFfiStatsEnabled)
+    GTEST_SKIP() << "built without TEMPOCH_FFI_STATS";
+  const auto tt = Time<scale::TT>::from_encoded(JulianDate<scale::TT>(2'460'000.5));
+
+  reset_ffi_stats_thread();
+  for (int i = 0; i < 3; ++i)
+    (void)tt.to<scale::TDB>();
+  const FfiStats stats = ffi_stats_thread();
+
+  EXPECT_EQ(stats[FfiEntry::tempoch_time_scale_convert].calls, 3u);
+  EXPECT_EQ(stats.total_calls(), 3u);
+  EXPECT_EQ(stats[FfiEntry::tempoch_time_to_civil].calls, 0u);
+
+  std::ostringstream os;
+  os << stats;
+  EXPECT_EQ(os.str().rfind("tempoch_time_scale_convert: 3 calls, ", 0), 0u);
+}
+
+TEST(FfiStats, CountsCallsFromTranslationUnitsBuiltWithoutTheFlag) {
+  if (!kFfiStatsEnabled)
+    GTEST_SKIP() << "built without TEMPOCH_FFI_STATS";
+  EXPECT_FALSE(ffi_stats_test::plain_tu_counts_calls());
+
+  const FfiStats before = ffi_stats_thread();
+  (void)ffi_stats_test::plain_tu_tt_to_tdb(2'460'000.5);
+  EXPECT_EQ((ffi_stats_thread() - before)[FfiEntry::tempoch_time_scale_convert].calls, 1u);
+}
+
+TEST(FfiStats, NativeRoutesStayOffTheBoundary) {
+  if (!kFfiStatsEnabled)
+    GTEST_SKIP() << "built without TEMPOCH_FFI_STATS";
+  const auto tai = Time<scale::TAI>::from_split_seconds(qtty::Second(8.0e8), qtty::Second(0.0));
+
+  const FfiStats before = ffi_stats_thread();
+  (void)tai.to<scale::TT>().to<scale::GPST>();
+  (void)(tai + qtty::Second(1.5));
+  EXPECT_EQ((ffi_stats_thread() - before).total_calls(), 0u);
+}
+
+TEST(FfiStats, AggregatesExitedThreads) {
+  if (!kFfiStatsEnabled)
+    GTEST_SKIP() << "built without TEMPOCH_FFI_STATS";
+  reset_ffi_stats();
+  std::thread worker([] {
+    for (int i = 0; i < 5; ++i)
+      (void)eop_covers(60'000.0 + i);
+  });
+  worker.join();
+
+  EXPECT_EQ(ffi_stats_thread()[FfiEntry::tempoch_eop_covers].calls, 0u);
+  EXPECT_EQ(ffi_stats()[FfiEntry::tempoch_eop_covers].calls, 5u);
+
+  reset_ffi_stats();
+  EXPECT_EQ(ffi_stats().total_calls(), 0u);
+}
+
+TEST(FfiStats, TimePeriodEndpointsStayOffTheBoundary) {
+  if (!kFfiStatsEnabled)
+    GTEST_SKIP() << "built without TEMPOCH_FFI_STATS";
+  const auto t0 = Time<scale::TT>::from_split_seconds(qtty::Second(8.0e8), qtty::Second(0.0));
+  const auto t1 = t0 + qtty::Second(3'600.0);
+
+  const FfiStats before = ffi_stats_thread();
+  const Period<Time<scale::TT>> period(t0, t1);
+  (void)period.start();
+  (void)period.end();
+  (void)period.contains(t0 + qtty::Second(1.0));
+  (void)period.duration<qtty::Second>();
+  (void)period.c_inner();
+  EXPECT_EQ((ffi_stats_thread() - before).total_calls(), 0u);
+}
+
+TEST(FfiStats, CivilPeriodEndpointsAreCached) {
+  if (!kFfiStatsEnabled)
+    GTEST_SKIP() << "built without TEMPOCH_FFI_STATS";
+  const UTCPeriod period(CivilTime(2026, 1, 1, 0, 0, 0), CivilTime(2026, 1, 2, 0, 0, 0));
+
+  const FfiStats before = ffi_stats_thread();
+  for (int i = 0; i < 10; ++i) {
+    (void)period.start();
+    (void)period.end();
+  }
+  (void)period.duration<qtty::Second>();
+  (void)period.c_inner();
+  EXPECT_EQ((ffi_stats_thread() - before).total_calls(), 0u);
+}
+
+TEST(FfiStats, PeriodContainersKeyTimePeriodsWithoutConversions) {
+  if (!kFfiStatsEnabled)
+    GTEST_SKIP() << "built without TEMPOCH_FFI_STATS";
+  using Utc = Time<scale::UTC>;
+  using P = Period<Utc>;
+  const Utc t0 = Utc::from_split_seconds(qtty::Second(8.0e8));
+  const std::vector<P> list = {P(t0 + qtty::Second(60.0), t0 + qtty::Second(120.0)),
+                               P(t0, t0 + qtty::Second(90.0))};
+
+  const FfiStats before = ffi_stats_thread();
+  const PeriodSet<Utc> set(list);
+  const PeriodIndex<Utc> index(list);
+  (void)set.contains(t0);
+  (void)set[0].end();
+  (void)index.containing(t0 + qtty::Second(75.0));
+  std::vector<P> merged;
+  sweep_union(list.begin(), list.begin() + 1, list.begin() + 1, list.end())
+      .copy_to(std::back_inserter(merged));
+  EXPECT_EQ((ffi_stats_thread() - before).total_calls(), 0u);
+}
+
+TEST(FfiStats, CivilBatchResolvesADayOnlyWhenItIsReused) {
+  if (!kFfiStatsEnabled)
+    GTEST_SKIP() << "built without TEMPOCH_FFI_STATS";
+  std::vector<Time<scale::UTC>> same_day;
+  std::vector<Time<scale::UTC>> distinct_days;
+  for (int i = 0; i < 8; ++i) {
+    same_day.push_back(Time<scale::UTC>::from_civil({2026, 3, 1, 10, static_cast<uint8_t>(i), 0}));
+    distinct_days.push_back(
+        Time<scale::UTC>::from_civil({2026, 3, static_cast<uint8_t>(i + 1), 10, 0, 0}));
+  }
+  std::vector<CivilTime> out(8);
+
+  reset_ffi_stats_thread();
+  ASSERT_TRUE(to_civil(same_day, out).all_ok());
+  EXPECT_EQ(ffi_stats_thread()[FfiEntry::tempoch_time_to_civil].calls, 1u);
+  EXPECT_EQ(ffi_stats_thread()[FfiEntry::tempoch_time_from_civil].calls, 1u);
+
+  reset_ffi_stats_thread();
+  ASSERT_TRUE(to_civil(distinct_days, out).all_ok());
+  EXPECT_EQ(ffi_stats_thread()[FfiEntry::tempoch_time_to_civil].calls, 8u);
+  EXPECT_EQ(ffi_stats_thread()[FfiEntry::tempoch_time_from_civil].calls, 0u);
+}
+
+TEST(FfiStats, LeapSnapshotOnlyServesTheDefaultUtcPolicy) {
+  if (!kFfiStatsEnabled)
+    GTEST_SKIP() << "built without TEMPOCH_FFI_STATS";
+  refresh_leap_table();
+  const auto utc = Time<scale::UTC>::from_civil({2020, 3, 14, 12, 0, 0});
+  const TimeContext custom = TimeContext().allow_pre_definition_utc();
+  (void)utc.try_to<scale::TT>(); // creates the shared default context
+
+  FfiStats before = ffi_stats_thread();
+  (void)utc.to<scale::TAI>();
+  (void)utc.try_to<scale::TAI>();
+  EXPECT_EQ((ffi_stats_thread() - before).total_calls(), 0u);
+
+  before = ffi_stats_thread();
+  (void)utc.to_with<scale::TAI>(custom);
+  EXPECT_EQ((ffi_stats_thread() - before)[FfiEntry::tempoch_time_scale_convert].calls, 1u);
+}
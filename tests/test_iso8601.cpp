@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for the ISO 8601 / RFC 3339 timestamp parser.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+void expect_civil(const Result<CivilTime> &r, int32_t y, int mo, int d, int h, int mi, int s,
+                  uint32_t ns) {
+  ASSERT_TRUE(r) << r.error().message();
+  EXPECT_EQ(r->year, y);
+  EXPECT_EQ(r->month, mo);
+  EXPECT_EQ(r->day, d);
+  EXPECT_EQ(r->hour, h);
+  EXPECT_EQ(r->minute, mi);
+  EXPECT_EQ(r->second, s);
+  EXPECT_EQ(r->nanosecond, ns);
+}
+
+} // namespace
+
+TEST(Iso8601, ParsesRfc3339Forms) {
+  expect_civil(parse_iso8601("2026-07-15T22:00:00Z"), 2026, 7, 15, 22, 0, 0, 0);
+  expect_civil(parse_iso8601("2026-07-15t22:00:00z"), 2026, 7, 15, 22, 0, 0, 0);
+  expect_civil(parse_iso8601("2026-07-15 22:00:00"), 2026, 7, 15, 22, 0, 0, 0);
+  expect_civil(parse_iso8601("2026-07-15T22:00:00.5Z"), 2026, 7, 15, 22, 0, 0, 500'000'000);
+  expect_civil(parse_iso8601("2026-07-15T22:00:00,000000001Z"), 2026, 7, 15, 22, 0, 0, 1);
+  expect_civil(parse_iso8601("2026-07-15T22:00:00.12345678Z"), 2026, 7, 15, 22, 0, 0, 123'456'780);
+  // Digits past the nanosecond are truncated.
+  expect_civil(parse_iso8601("2026-07-15T22:00:00.1234567899Z"), 2026, 7, 15, 22, 0, 0,
+               123'456'789);
+}
+
+TEST(Iso8601, AppliesOffsets) {
+  expect_civil(parse_iso8601("2026-07-16T00:30:00+02:00"), 2026, 7, 15, 22, 30, 0, 0);
+  expect_civil(parse_iso8601("2026-07-15T22:30:00-0530"), 2026, 7, 16, 4, 0, 0, 0);
+  expect_civil(parse_iso8601("2024-03-01T01:00:00+03"), 2024, 2, 29, 22, 0, 0, 0);
+  expect_civil(parse_iso8601("2025-12-31T20:00:00-04:00"), 2026, 1, 1, 0, 0, 0, 0);
+  expect_civil(parse_iso8601("2026-07-15T22:00:00-00:00"), 2026, 7, 15, 22, 0, 0, 0);
+}
+
+TEST(Iso8601, AcceptsLeapSecondsOnlyAtTheEndOfTheUtcDay) {
+  expect_civil(parse_iso8601("2016-12-31T23:59:60Z"), 2016, 12, 31, 23, 59, 60, 0);
+  expect_civil(parse_iso8601("2017-01-01T00:59:60.25+01:00"), 2016, 12, 31, 23, 59, 60,
+               250'000'000);
+  EXPECT_FALSE(parse_iso8601("2016-12-31T12:00:60Z"));
+  EXPECT_FALSE(parse_iso8601("2016-12-31T23:59:61Z"));
+}
+
+TEST(Iso8601, RejectsMalformedText) {
+  for (const char *bad :
+       {"", "2026-07-15", "2026-07-15T22:00", "2026-7-15T22:00:00Z", "2026-07-15X22:00:00Z",
+        "2026-13-01T00:00:00Z", "2025-02-29T00:00:00Z", "2026-04-31T00:00:00Z",
+        "2026-07-15T24:00:00Z", "2026-07-15T22:60:00Z", "2026-07-15T22:00:00.Z",
+        "2026-07-15T22:00:00Z ", "2026-07-15T22:00:00+2:00", "2026-07-15T22:00:00+24:00",
+        "2026-07-15T22:00:00+02:0", "2026-07-15T22:00:00+05:", "2026-07-15T22:00:00-05:Z",
+        "2026-07-15T22:00:00UTC"}) {
+    const auto r = parse_iso8601(bad);
+    EXPECT_FALSE(r) << bad;
+    EXPECT_EQ(r.status(), TEMPOCH_STATUS_T_CONVERSION_FAILED) << bad;
+  }
+  EXPECT_STREQ(parse_iso8601("nope").error().operation, "parse_iso8601");
+  expect_civil(parse_iso8601("2024-02-29T00:00:00Z"), 2024, 2, 29, 0, 0, 0, 0);
+}
+
+TEST(Iso8601, ParsesToUtcTime) {
+  const auto utc = parse_iso8601_utc("2026-07-16T00:00:00.25+02:00");
+  ASSERT_TRUE(utc);
+  const auto expected = Time<scale::UTC>::from_civil(CivilTime(2026, 7, 15, 22, 0, 0, 250'000'000));
+  EXPECT_EQ(utc->c_inner().hi_seconds + utc->c_inner().lo_seconds,
+            expected.c_inner().hi_seconds + expected.c_inner().lo_seconds);
+  EXPECT_EQ(parse_iso8601_utc("garbage").status(), TEMPOCH_STATUS_T_CONVERSION_FAILED);
+}
+
+TEST(Iso8601, BatchAndFixedWidthMatchScalar) {
+  const std::vector<std::string> lines{
+      "2026-07-15T22:00:00.000000001Z", "2026-07-15 22:00:01.5+01:00  ",
+      "2016-12-31T23:59:60.000000000Z", "2026-02-30T00:00:00.000000000Z",
+      "2026-07-15t23:59:59.999999999Z"};
+  std::string block;
+  const std::size_t stride = 32;
+  for (const auto &line : lines)
+    block += line + std::string(stride - 1 - line.size(), ' ') + '\n';
+
+  std::vector<CivilTime> fixed(lines.size());
+  const BatchStatus fixed_status = parse_iso8601_fixed(block, stride, fixed);
+  std::vector<std::string_view> views(lines.begin(), lines.end());
+  std::vector<CivilTime> each(lines.size());
+  const BatchStatus each_status = parse_iso8601(span<const std::string_view>(views), each);
+
+  EXPECT_EQ(fixed_status.failed(), 1u);
+  EXPECT_EQ(each_status.failed(), 2u); // the unpadded view keeps its trailing spaces
+  EXPECT_FALSE(fixed_status.ok(3));
+  for (std::size_t i : {0u, 2u, 4u}) {
+    const auto scalar = parse_iso8601(lines[i]);
+    ASSERT_TRUE(scalar);
+    EXPECT_EQ(fixed[i].second, scalar->second) << i;
+    EXPECT_EQ(fixed[i].nanosecond, scalar->nanosecond) << i;
+    EXPECT_EQ(each[i].nanosecond, scalar->nanosecond) << i;
+  }
+  EXPECT_EQ(fixed[1].hour, 21);
+  EXPECT_EQ(fixed[1].nanosecond, 500'000'000u);
+  EXPECT_THROW(parse_iso8601_fixed(block, stride + 1, fixed), TempochException);
+
+  // ':' and '/' sit right above and below '9' and '0' in ASCII.
+  std::vector<CivilTime> one(1);
+  EXPECT_FALSE(parse_iso8601_fixed("2026-07-1:T22:00:00Z", 20, one).ok(0));
+  EXPECT_FALSE(parse_iso8601_fixed("2026-07-15T22:0/:00Z", 20, one).ok(0));
+  EXPECT_TRUE(parse_iso8601_fixed("2026-07-15T22:09:00Z", 20, one).ok(0));
+  EXPECT_EQ(one[0].minute, 9);
+}
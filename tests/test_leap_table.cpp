@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Parity tests: the in-process leap-second snapshot against tempoch-ffi.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+tempoch_time_t ffi_convert(const tempoch_time_t &value, tempoch_scale_tag_t from,
+                           tempoch_scale_tag_t to) {
+  tempoch_time_t out{};
+  check_status(tempoch_time_scale_convert(value, from, to, nullptr, &out),
+               "tempoch_time_scale_convert");
+  return out;
+}
+
+double split_at(const CivilTime &civil) {
+  const auto t = Time<scale::UTC>::from_civil(civil);
+  return t.c_inner().hi_seconds + t.c_inner().lo_seconds;
+}
+
+// Instants spread over the snapshot, including the seconds around leap
+// seconds where the lookup must defer to tempoch-ffi.
+std::vector<tempoch_time_t> sample_instants() {
+  std::vector<tempoch_time_t> out;
+  for (int32_t year = 1972; year <= 2040; year += 3) {
+    for (int month : {1, 6, 7, 12}) {
+      const double base = split_at(CivilTime(year, static_cast<uint8_t>(month), 1));
+      for (double delta : {-86'400.5, -3.0, -1.0, -0.25, 0.0, 0.5, 1.0, 2.0, 3.5, 1'234'567.125})
+        out.push_back(detail::make_split(base + delta, 1.0e-7));
+    }
+  }
+  return out;
+}
+
+} // namespace
+
+TEST(LeapTable, SnapshotCoversModernUtc) {
+  refresh_leap_table();
+  detail::LeapCursor cursor;
+  const detail::LeapTable *table = detail::leap_table_for_thread(cursor);
+  ASSERT_NE(table, nullptr);
+  ASSERT_FALSE(table->intervals().empty());
+  for (std::size_t i = 1; i < table->intervals().size(); ++i) {
+    EXPECT_EQ(table->intervals()[i - 1].utc_end, table->intervals()[i].utc_begin);
+    EXPECT_NE(table->intervals()[i - 1].tai_minus_utc, table->intervals()[i].tai_minus_utc);
+  }
+  double offset = 0.0;
+  ASSERT_TRUE(detail::leap_tai_minus_utc(split_at(CivilTime(2020, 3, 14, 12, 0, 0)), &offset));
+  EXPECT_EQ(offset, 37.0);
+  ASSERT_TRUE(detail::leap_tai_minus_utc(split_at(CivilTime(1980, 3, 14, 12, 0, 0)), &offset));
+  EXPECT_EQ(offset, 19.0);
+  EXPECT_FALSE(detail::leap_tai_minus_utc(split_at(CivilTime(2017, 1, 1, 0, 0, 1)), &offset));
+  EXPECT_FALSE(detail::leap_tai_minus_utc(std::nan(""), &offset));
+}
+
+TEST(LeapTable, UtcTaiMatchesFfi) {
+  for (const tempoch_time_t &utc : sample_instants()) {
+    const auto tai = Time<scale::UTC>::from_c(utc).to<scale::TAI>();
+    EXPECT_EQ(detail::split_difference(tai.c_inner(), ffi_convert(utc, TEMPOCH_SCALE_TAG_T_UTC,
+                                                                  TEMPOCH_SCALE_TAG_T_TAI)),
+              0.0)
+        << utc.hi_seconds;
+    const tempoch_time_t tai_raw = tai.c_inner();
+    const auto back = Time<scale::TAI>::from_c(tai_raw).to<scale::UTC>();
+    EXPECT_EQ(detail::split_difference(back.c_inner(), ffi_convert(tai_raw, TEMPOCH_SCALE_TAG_T_TAI,
+                                                                   TEMPOCH_SCALE_TAG_T_UTC)),
+              0.0)
+        << tai_raw.hi_seconds;
+  }
+}
+
+TEST(LeapTable, UtcToFixedOffsetScalesMatchesFfi) {
+  for (const tempoch_time_t &utc : sample_instants()) {
+    const auto tt = Time<scale::UTC>::from_c(utc).to<scale::TT>();
+    EXPECT_EQ(detail::split_difference(
+                  tt.c_inner(), ffi_convert(utc, TEMPOCH_SCALE_TAG_T_UTC, TEMPOCH_SCALE_TAG_T_TT)),
+              0.0);
+    const auto gps = Time<scale::UTC>::from_c(utc).to<scale::GPST>();
+    const auto back = gps.to<scale::UTC>();
+    EXPECT_EQ(detail::split_difference(back.c_inner(),
+                                       ffi_convert(gps.c_inner(), TEMPOCH_SCALE_TAG_T_GPST,
+                                                   TEMPOCH_SCALE_TAG_T_UTC)),
+              0.0);
+  }
+}
+
+TEST(LeapTable, UnixEncodingMatchesFfi) {
+  for (const tempoch_time_t &utc : sample_instants()) {
+    double ffi_unix = 0.0;
+    check_status(tempoch_time_to_format(utc, TEMPOCH_SCALE_TAG_T_UTC, TEMPOCH_FORMAT_TAG_T_UNIX,
+                                        nullptr, &ffi_unix),
+                 "tempoch_time_to_format");
+    const auto unix = Time<scale::UTC>::from_c(utc).to<format::Unix>();
+    EXPECT_DOUBLE_EQ(unix.value(), ffi_unix);
+
+    tempoch_time_t ffi_back{};
+    check_status(tempoch_time_from_format(ffi_unix, TEMPOCH_SCALE_TAG_T_UTC,
+                                          TEMPOCH_FORMAT_TAG_T_UNIX, nullptr, &ffi_back),
+                 "tempoch_time_from_format");
+    const auto back = Time<scale::UTC>::from_encoded(UnixTime(ffi_unix));
+    EXPECT_EQ(detail::split_difference(back.c_inner(), ffi_back), 0.0);
+  }
+}
+
+TEST(LeapTable, BundleChangeReplacesTheSnapshot) {
+  detail::LeapTableRegistry &registry = detail::LeapTableRegistry::instance();
+  refresh_leap_table();
+  detail::LeapCursor cursor;
+  const detail::LeapTable *before = detail::leap_table_for_thread(cursor);
+  ASSERT_NE(before, nullptr);
+  const uint64_t generation = registry.generation.load();
+  const std::size_t intervals = before->intervals().size();
+
+  // Same bundle: nothing to do.
+  registry.observe(detail::active_time_data_fingerprint());
+  EXPECT_EQ(registry.generation.load(), generation);
+  EXPECT_EQ(detail::leap_table_for_thread(cursor), before);
+
+  // A different bundle drops the snapshot and builds the active one at once.
+  TempochDataHorizons moved = before->fingerprint();
+  moved.source = moved.source + 1;
+  registry.observe(moved);
+  EXPECT_GT(registry.generation.load(), generation);
+  const detail::LeapTable *after = detail::leap_table_for_thread(cursor);
+  ASSERT_NE(after, nullptr);
+  EXPECT_NE(after, before);
+  EXPECT_TRUE(
+      detail::same_fingerprint(after->fingerprint(), detail::active_time_data_fingerprint()));
+  EXPECT_EQ(after->intervals().size(), intervals);
+  EXPECT_EQ(registry.current().get(), after);
+}
+
+TEST(LeapTable, LookupsNeverBuildAndFailedBuildsBackOff) {
+  detail::LeapTableRegistry &registry = detail::LeapTableRegistry::instance();
+  refresh_leap_table();
+  const double utc = split_at(CivilTime(2020, 3, 14, 12, 0, 0));
+  double offset = 0.0;
+
+  // Without a snapshot lookups defer to tempoch-ffi instead of building one.
+  std::atomic_store(&registry.table, std::shared_ptr<const detail::LeapTable>());
+  registry.generation.fetch_add(1);
+  EXPECT_FALSE(detail::leap_tai_minus_utc(utc, &offset));
+  EXPECT_EQ(registry.current(), nullptr);
+  const tempoch_time_t at = detail::make_split(utc, 0.0);
+  EXPECT_EQ(detail::split_difference(Time<scale::UTC>::from_c(at).to<scale::TAI>().c_inner(),
+                                     ffi_convert(at, TEMPOCH_SCALE_TAG_T_UTC,
+                                                 TEMPOCH_SCALE_TAG_T_TAI)),
+            0.0);
+  EXPECT_EQ(registry.current(), nullptr);
+
+  // A build that failed for the active bundle is not retried implicitly...
+  {
+    std::lock_guard<std::mutex> lock(registry.build_mutex);
+    registry.build_failed = true;
+    registry.failed_fingerprint = detail::active_time_data_fingerprint();
+  }
+  registry.ensure_built();
+  (void)TimeContext();
+  EXPECT_EQ(registry.current(), nullptr);
+
+  // ...only by an explicit refresh.
+  refresh_leap_table();
+  ASSERT_NE(registry.current(), nullptr);
+  EXPECT_TRUE(detail::leap_tai_minus_utc(utc, &offset));
+  EXPECT_EQ(offset, 37.0);
+}
+
+TEST(LeapTable, SplitOffsetMatchesFfiOnArbitraryPairs) {
+  refresh_leap_table();
+  const double begin = split_at(CivilTime(1972, 1, 1));
+  const double end = split_at(CivilTime(2099, 12, 1));
+  std::mt19937_64 rng(20260301);
+  std::uniform_real_distribution<double> hi(begin, end);
+  std::uniform_real_distribution<double> lo(-0.5, 0.5);
+  int native = 0;
+  for (int i = 0; i < 20'000; ++i) {
+    tempoch_time_t utc{};
+    ASSERT_EQ(detail::try_make_time(std::floor(hi(rng)), lo(rng) * std::ldexp(1.0, -(i % 40)),
+                                    &utc),
+              TEMPOCH_STATUS_T_OK);
+    double tai_minus_utc = 0.0;
+    if (!detail::leap_tai_minus_utc(utc.hi_seconds + utc.lo_seconds, &tai_minus_utc))
+      continue;
+    ++native;
+    const tempoch_time_t tai = detail::split_add(utc, tai_minus_utc);
+    const tempoch_time_t ffi_tai =
+        ffi_convert(utc, TEMPOCH_SCALE_TAG_T_UTC, TEMPOCH_SCALE_TAG_T_TAI);
+    EXPECT_EQ(tai.hi_seconds, ffi_tai.hi_seconds) << utc.hi_seconds << " + " << utc.lo_seconds;
+    EXPECT_EQ(tai.lo_seconds, ffi_tai.lo_seconds) << utc.hi_seconds << " + " << utc.lo_seconds;
+
+    const tempoch_time_t back = detail::split_add(tai, -tai_minus_utc);
+    const tempoch_time_t ffi_back =
+        ffi_convert(tai, TEMPOCH_SCALE_TAG_T_TAI, TEMPOCH_SCALE_TAG_T_UTC);
+    EXPECT_EQ(back.hi_seconds, ffi_back.hi_seconds) << tai.hi_seconds << " + " << tai.lo_seconds;
+    EXPECT_EQ(back.lo_seconds, ffi_back.lo_seconds) << tai.hi_seconds << " + " << tai.lo_seconds;
+  }
+  EXPECT_GT(native, 19'000);
+}
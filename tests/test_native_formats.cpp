@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Parity tests: header-only JD / MJD / J2000s transcoding against tempoch-ffi.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+constexpr std::array<double, 6> kJulianDates{
+    {2'451'545.0, 2'451'544.5, 2'444'244.5, 2'460'000.123'456'789, 2'415'020.5, 2'488'069.5}};
+
+template <typename S, typename From, typename To> double via_ffi(double raw) {
+  tempoch_time_t split{};
+  check_status(tempoch_time_from_format(raw, static_cast<int32_t>(scale_tag_v<S>),
+                                        static_cast<int32_t>(format_tag_v<From>), nullptr, &split),
+               "tempoch_time_from_format");
+  double out = 0.0;
+  check_status(tempoch_time_to_format(split, static_cast<int32_t>(scale_tag_v<S>),
+                                      static_cast<int32_t>(format_tag_v<To>), nullptr, &out),
+               "tempoch_time_to_format");
+  return out;
+}
+
+// Day-count values carry ~40 µs of resolution near the present; compare in
+// seconds with a few ulps of the JD value as slack.
+constexpr double kDayCountTolerance = 1e-9;
+constexpr double kSecondsTolerance = 1e-4;
+
+// TAI split values from 1972 to 2099.
+std::vector<tempoch_time_t> tai_instants() {
+  std::vector<tempoch_time_t> out;
+  for (double hi = -8.6e8; hi < 3.1e9; hi += 4.7e7)
+    out.push_back(detail::make_split(hi + 0.125, 3.0e-8));
+  out.push_back(detail::make_split(-630'763'181.0, 0.0)); // the GPS epoch itself
+  out.push_back(detail::make_split(1.0e9, -1.0e-9));
+  return out;
+}
+
+} // namespace
+
+TEST(NativeFormats, RoutesAreResolvedAtCompileTime) {
+  static_assert(detail::has_native_format_route_v<scale::TT, format::JD, format::MJD>);
+  static_assert(!detail::has_native_format_route_v<scale::UTC, format::MJD, format::JD>);
+  static_assert(!detail::has_native_format_route_v<scale::UT1, format::JD, format::MJD>);
+  static_assert(detail::has_native_format_route_v<scale::TDB, format::JD, format::J2000s>);
+  static_assert(detail::has_native_format_route_v<scale::TAI, format::J2000s, format::MJD>);
+  static_assert(!detail::has_native_format_route_v<scale::UTC, format::JD, format::J2000s>);
+  static_assert(!detail::has_native_format_route_v<scale::UT1, format::J2000s, format::MJD>);
+  static_assert(!detail::has_native_format_route_v<scale::TT, format::JD, format::Unix>);
+  static_assert(!detail::has_native_format_route_v<scale::TT, format::JD, format::JD>);
+  static_assert(detail::has_native_split_codec_v<scale::TT, format::J2000s>);
+  static_assert(!detail::has_native_split_codec_v<scale::UTC, format::J2000s>);
+  static_assert(detail::has_gps_seconds_route_v<scale::TAI, format::GPS>);
+  static_assert(!detail::has_gps_seconds_route_v<scale::GPST, format::GPS>);
+  static_assert(!detail::has_gps_seconds_route_v<scale::TAI, format::Unix>);
+}
+
+TEST(NativeFormats, JulianAndModifiedJulianMatchFfi) {
+  for (double jd : kJulianDates) {
+    const double mjd = EncodedTime<scale::TT, format::JD>(jd).to<format::MJD>().value();
+    EXPECT_NEAR(mjd, (via_ffi<scale::TT, format::JD, format::MJD>(jd)), kDayCountTolerance);
+    const double back = EncodedTime<scale::TT, format::MJD>(mjd).to<format::JD>().value();
+    EXPECT_NEAR(back, jd, kDayCountTolerance);
+  }
+}
+
+TEST(NativeFormats, UtcDayCountsStayOnTheEngine) {
+  for (double jd : kJulianDates) {
+    if (jd < 2'441'317.5) // before 1972, outside the default UTC policy
+      continue;
+    const double mjd = EncodedTime<scale::UTC, format::JD>(jd).to<format::MJD>().value();
+    EXPECT_EQ(mjd, (via_ffi<scale::UTC, format::JD, format::MJD>(jd)));
+    const double back = EncodedTime<scale::UTC, format::MJD>(mjd).to<format::JD>().value();
+    EXPECT_EQ(back, (via_ffi<scale::UTC, format::MJD, format::JD>(mjd)));
+  }
+  EXPECT_THROW((EncodedTime<scale::UTC, format::JD>(std::nan("")).to<format::MJD>()),
+               TempochException);
+}
+
+TEST(NativeFormats, J2000SecondsMatchFfi) {
+  for (double jd : kJulianDates) {
+    const double seconds = EncodedTime<scale::TAI, format::JD>(jd).to<format::J2000s>().value();
+    EXPECT_NEAR(seconds, (via_ffi<scale::TAI, format::JD, format::J2000s>(jd)), kSecondsTolerance);
+    const double mjd =
+        EncodedTime<scale::TDB, format::J2000s>(seconds).to<format::MJD>().value();
+    EXPECT_NEAR(mjd, (via_ffi<scale::TDB, format::J2000s, format::MJD>(seconds)),
+                kDayCountTolerance);
+  }
+  EXPECT_EQ((EncodedTime<scale::TT, format::JD>(2'451'545.0).to<format::J2000s>().value()), 0.0);
+}
+
+TEST(NativeFormats, J2000SecondsCodecKeepsSplitStorage) {
+  const auto t = Time<scale::TT>::from_c(tempoch_time_t{123'456'789.0, 0.25});
+  EXPECT_DOUBLE_EQ(t.to<format::J2000s>().value(), 123'456'789.25);
+  const auto decoded = Time<scale::TT>::from_encoded(EncodedTime<scale::TT, format::J2000s>(-1.5));
+  EXPECT_EQ(decoded.c_inner().hi_seconds + decoded.c_inner().lo_seconds, -1.5);
+  EXPECT_THROW((Time<scale::TT>::from_encoded(
+                   EncodedTime<scale::TT, format::J2000s>(std::nan("")))),
+               TempochException);
+}
+
+TEST(NativeFormats, GpsSecondsOnTaiMatchFfi) {
+  EXPECT_NEAR((constants::gps_epoch_jd_tai() - detail::kJ2000JulianDate) *
+                  detail::kSecondsPerJulianDay,
+              -detail::kGpsSecondsMinusTai, kSecondsTolerance);
+  for (const tempoch_time_t &value : tai_instants()) {
+    double ffi = 0.0;
+    check_status(tempoch_time_to_format(value, TEMPOCH_SCALE_TAG_T_TAI, TEMPOCH_FORMAT_TAG_T_GPS,
+                                        nullptr, &ffi),
+                 "tempoch_time_to_format");
+    EXPECT_EQ(Time<scale::TAI>::from_c(value).to<format::GPS>().value(), ffi) << value.hi_seconds;
+
+    tempoch_time_t ffi_back{};
+    check_status(tempoch_time_from_format(ffi, TEMPOCH_SCALE_TAG_T_TAI, TEMPOCH_FORMAT_TAG_T_GPS,
+                                          nullptr, &ffi_back),
+                 "tempoch_time_from_format");
+    const auto back = Time<scale::TAI>::from_encoded(EncodedTime<scale::TAI, format::GPS>(ffi));
+    EXPECT_EQ(detail::split_difference(back.c_inner(), ffi_back), 0.0) << ffi;
+  }
+  EXPECT_THROW(
+      (Time<scale::TAI>::from_encoded(EncodedTime<scale::TAI, format::GPS>(std::nan("")))),
+      TempochException);
+}
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Parity tests: header-only affine scale routes against tempoch-ffi.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <array>
+
+using namespace tempoch;
+
+namespace {
+
+constexpr std::array<tempoch_time_t, 7> kInstants{{
+    {0.0, 0.0},
+    {-725'803'167.816, 0.0},
+    {-630'763'200.0, 0.0},
+    {123'456'789.0, 0.123'456'789},
+    {835'000'000.5, -1.0e-10},
+    {-3.2e9, 0.25},
+    {4.1e9, 3.0e-9},
+}};
+
+template <typename From, typename To> tempoch_time_t via_ffi(const tempoch_time_t &value) {
+  tempoch_time_t out{};
+  check_status(tempoch_time_scale_convert(value, static_cast<int32_t>(scale_tag_v<From>),
+                                          static_cast<int32_t>(scale_tag_v<To>), nullptr, &out),
+               "tempoch_time_scale_convert");
+  return out;
+}
+
+template <typename From, typename To> void expect_exact_parity() {
+  static_assert(detail::has_native_scale_route_v<From, To>);
+  for (const auto &value : kInstants) {
+    const tempoch_time_t native = detail::native_scale_convert<From, To>(value);
+    const tempoch_time_t ffi = via_ffi<From, To>(value);
+    EXPECT_EQ(native.hi_seconds, ffi.hi_seconds)
+        << ScaleTraits<From>::name() << " -> " << ScaleTraits<To>::name() << " at "
+        << value.hi_seconds;
+    EXPECT_EQ(native.lo_seconds, ffi.lo_seconds)
+        << ScaleTraits<From>::name() << " -> " << ScaleTraits<To>::name() << " at "
+        << value.hi_seconds;
+  }
+}
+
+} // namespace
+
+TEST(NativeScales, RoutesAreResolvedAtCompileTime) {
+  static_assert(detail::has_native_scale_route_v<scale::TAI, scale::TT>);
+  static_assert(detail::has_native_scale_route_v<scale::GPST, scale::BDT>);
+  static_assert(!detail::has_native_scale_route_v<scale::UTC, scale::TAI>);
+  static_assert(!detail::has_native_scale_route_v<scale::TT, scale::TDB>);
+  static_assert(!detail::has_native_scale_route_v<scale::TT, scale::TCG>);
+  static_assert(!detail::has_native_scale_route_v<scale::TT, scale::UT1>);
+  static_assert(!detail::has_native_scale_route_v<scale::TT, scale::TT>);
+
+  constexpr auto tt = detail::native_scale_convert<scale::TAI, scale::TT>({1.0, 0.0});
+  static_assert(tt.hi_seconds + tt.lo_seconds == 1.0 + 32.184);
+}
+
+TEST(NativeScales, FixedOffsetParityWithFfi) {
+  expect_exact_parity<scale::TAI, scale::TT>();
+  expect_exact_parity<scale::TT, scale::TAI>();
+  expect_exact_parity<scale::TAI, scale::GPST>();
+  expect_exact_parity<scale::GPST, scale::TAI>();
+  expect_exact_parity<scale::TAI, scale::GST>();
+  expect_exact_parity<scale::TAI, scale::QZSST>();
+  expect_exact_parity<scale::TAI, scale::BDT>();
+  expect_exact_parity<scale::BDT, scale::TAI>();
+  expect_exact_parity<scale::TT, scale::GPST>();
+  expect_exact_parity<scale::GPST, scale::TT>();
+  expect_exact_parity<scale::GPST, scale::GST>();
+  expect_exact_parity<scale::GST, scale::GPST>();
+  expect_exact_parity<scale::GPST, scale::QZSST>();
+  expect_exact_parity<scale::QZSST, scale::GST>();
+  expect_exact_parity<scale::GPST, scale::BDT>();
+  expect_exact_parity<scale::BDT, scale::TT>();
+}
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for the multi-threaded period list operations.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+using Mjd = ModifiedJulianDate<scale::TT>;
+using MjdPeriod = Period<Mjd>;
+
+/// Unsorted periods on a quarter-day grid: overlaps, touching pairs, equal starts, empties.
+std::vector<MjdPeriod> random_unsorted(std::size_t n, double spread) {
+  std::vector<MjdPeriod> out;
+  out.reserve(n);
+  std::uint64_t state = 0x2545f4914f6cdd1dull;
+  for (std::size_t i = 0; i < n; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    const double start = static_cast<double>(state % static_cast<std::uint64_t>(spread)) * 0.25;
+    const double length = static_cast<double>((state >> 32) % 5) * 0.25;
+    out.push_back(MjdPeriod::from_c({start, start + length}));
+  }
+  return out;
+}
+
+std::vector<std::pair<double, double>> mjds(const std::vector<MjdPeriod> &list) {
+  std::vector<std::pair<double, double>> out;
+  for (const auto &p : list)
+    out.emplace_back(p.c_inner().start_mjd, p.c_inner().end_mjd);
+  return out;
+}
+
+} // namespace
+
+TEST(Parallel, NormalizeMatchesSerial) {
+  for (double spread : {4.0e3, 1.0e6}) {
+    const auto list = random_unsorted(3 * kParallelNormalizeMinSize + 17, spread);
+    const auto serial = mjds(normalize_periods(list));
+    for (unsigned threads : {1u, 2u, 3u, 8u})
+      EXPECT_EQ(mjds(normalize_periods(par.with_threads(threads), list)), serial)
+          << threads << " threads, spread " << spread;
+    EXPECT_EQ(mjds(normalize_periods(par, list)), serial);
+  }
+}
+
+TEST(Parallel, NormalizeHandlesSkewAndSmallInputs) {
+  // Every period starts at the same instant, so one bucket receives everything.
+  std::vector<MjdPeriod> same_start;
+  for (std::size_t i = 0; i < kParallelNormalizeMinSize * 2; ++i)
+    same_start.push_back(MjdPeriod::from_c({100.0, 100.0 + static_cast<double>(i % 7)}));
+  EXPECT_EQ(mjds(normalize_periods(par.with_threads(4), same_start)),
+            mjds(normalize_periods(same_start)));
+
+  const auto small = random_unsorted(100, 50.0);
+  EXPECT_EQ(mjds(normalize_periods(par.with_threads(4), small)), mjds(normalize_periods(small)));
+  EXPECT_TRUE(normalize_periods(par, std::vector<MjdPeriod>{}).empty());
+}
+
+TEST(Parallel, NormalizeRejectsInvalidPeriods) {
+  auto list = random_unsorted(kParallelNormalizeMinSize * 2, 1.0e5);
+  list[list.size() / 2] = MjdPeriod::from_c({2.0, 1.0});
+  EXPECT_THROW(normalize_periods(par.with_threads(4), list), InvalidPeriodError);
+  EXPECT_EQ(checked_normalize_periods(par.with_threads(4), list).status(),
+            TEMPOCH_STATUS_T_INVALID_PERIOD);
+  list[list.size() / 2] = MjdPeriod::from_c({2.0, 3.0});
+  EXPECT_TRUE(checked_normalize_periods(par.with_threads(4), list));
+}
+
+TEST(Parallel, NormalizeKeepsSplitEndpointsOfTimePeriods) {
+  using Tt = Time<scale::TT>;
+  using P = Period<Tt>;
+  const Tt t0 = Tt::from_split_seconds(qtty::Second(8.0e8), qtty::Second(1.0e-10));
+  std::vector<P> list;
+  for (std::size_t i = 2 * kParallelNormalizeMinSize; i-- > 0;) {
+    const Tt start = t0 + qtty::Second(2.0e-9 * static_cast<double>(i));
+    list.emplace_back(start, start + qtty::Second(1.0e-9));
+  }
+
+  const auto merged = normalize_periods(par.with_threads(4), list);
+  ASSERT_EQ(merged.size(), list.size());
+  for (std::size_t i = 0; i < merged.size(); ++i) {
+    ASSERT_EQ(merged[i].start(), list[list.size() - 1 - i].start()) << i;
+    ASSERT_EQ(merged[i].end(), list[list.size() - 1 - i].end()) << i;
+  }
+}
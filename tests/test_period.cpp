@@ -1,6 +1,11 @@
 #include <gtest/gtest.h>
 #include <tempoch/tempoch.hpp>
+
+#include <cmath>
+#include <limits>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 using namespace tempoch;
 
@@ -109,3 +114,220 @@ TEST(Period, ToWithUsesProvidedContextForBothEndpoints) {
                    (p.start().to_with<scale::UT1, format::MJD>(ctx).value()));
   EXPECT_DOUBLE_EQ(ut1_mjd.end().value(), (p.end().to_with<scale::UT1, format::MJD>(ctx).value()));
 }
+
+TEST(Period, HalfOpenContainsAndTouchingIntersection) {
+  using MjdTt = ModifiedJulianDate<scale::TT>;
+  Period<MjdTt> a(MjdTt(60000.0), MjdTt(60001.0));
+  Period<MjdTt> b(MjdTt(60001.0), MjdTt(60002.0));
+
+  EXPECT_TRUE(a.contains(MjdTt(60000.0)));
+  EXPECT_FALSE(a.contains(MjdTt(60001.0)));
+  EXPECT_THROW(a.intersection(b), NoIntersectionError);
+  EXPECT_EQ(a.union_with(b).size(), 1u);
+  EXPECT_THROW(Period<MjdTt>(MjdTt(60001.0), MjdTt(60000.0)), InvalidPeriodError);
+}
+
+TEST(Period, InlineScalarAlgebraMatchesFfi) {
+  const double nan = std::nan("");
+  const std::vector<double> edges{59999.0, 60000.0, 60000.25, 60000.5, 60001.0, 60002.0, nan};
+  std::vector<tempoch_period_mjd_t> periods;
+  for (double s : edges)
+    for (double e : edges)
+      periods.push_back({s, e});
+
+  for (const auto &p : periods) {
+    tempoch_period_mjd_t inline_out{}, ffi_out{};
+    const auto inline_status = detail::period_new(p.start_mjd, p.end_mjd, &inline_out);
+    ASSERT_EQ(inline_status, tempoch_period_mjd_new(p.start_mjd, p.end_mjd, &ffi_out));
+    if (inline_status != TEMPOCH_STATUS_T_OK)
+      continue;
+    EXPECT_EQ(inline_out.start_mjd, ffi_out.start_mjd);
+    EXPECT_EQ(inline_out.end_mjd, ffi_out.end_mjd);
+    EXPECT_EQ(p.end_mjd - p.start_mjd, tempoch_period_mjd_duration_qty(p).value);
+    for (double m : edges)
+      EXPECT_EQ(detail::period_contains(p, m), tempoch_period_mjd_contains(p, m))
+          << "[" << p.start_mjd << ", " << p.end_mjd << ") contains " << m;
+  }
+
+  for (const auto &a : periods) {
+    if (!(a.start_mjd <= a.end_mjd))
+      continue;
+    for (const auto &b : periods) {
+      if (!(b.start_mjd <= b.end_mjd))
+        continue;
+      tempoch_period_mjd_t inline_out{}, ffi_out{};
+      const auto status = detail::period_intersection(a, b, &inline_out);
+      ASSERT_EQ(status, tempoch_period_mjd_intersection(a, b, &ffi_out));
+      if (status == TEMPOCH_STATUS_T_OK) {
+        EXPECT_EQ(inline_out.start_mjd, ffi_out.start_mjd);
+        EXPECT_EQ(inline_out.end_mjd, ffi_out.end_mjd);
+      }
+
+      tempoch_period_mjd_t inline_union[2], ffi_union[2];
+      std::size_t ffi_count = 0;
+      const std::size_t count = detail::period_union(a, b, inline_union);
+      ASSERT_EQ(tempoch_period_mjd_union(a, b, ffi_union, &ffi_count), TEMPOCH_STATUS_T_OK);
+      ASSERT_EQ(count, ffi_count);
+      for (std::size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(inline_union[i].start_mjd, ffi_union[i].start_mjd);
+        EXPECT_EQ(inline_union[i].end_mjd, ffi_union[i].end_mjd);
+      }
+    }
+  }
+}
+
+TEST(Period, ListOperationsWriteIntoCallerBuffers) {
+  using MjdTt = ModifiedJulianDate<scale::TT>;
+  using P = Period<MjdTt>;
+  const auto p = [](double s, double e) { return P(MjdTt(s), MjdTt(e)); };
+  const std::vector<P> a{p(0, 2), p(4, 6), p(8, 10)};
+  const std::vector<P> b{p(1, 5), p(9, 12)};
+  const auto mjds = [](const P *first, const P *last) {
+    std::vector<std::pair<double, double>> out;
+    for (; first != last; ++first)
+      out.emplace_back(first->c_inner().start_mjd, first->c_inner().end_mjd);
+    return out;
+  };
+  const auto all = [&](const std::vector<P> &v) { return mjds(v.data(), v.data() + v.size()); };
+
+  // Output bound for intersect / union is |a| + |b|.
+  P buffer[5] = {p(0, 0), p(0, 0), p(0, 0), p(0, 0), p(0, 0)};
+  P *end = intersect_periods(span<const P>(a), span<const P>(b), buffer);
+  EXPECT_EQ(mjds(buffer, end), all(intersect_periods(a, b)));
+
+  end = union_periods(span<const P>(a), span<const P>(b), buffer);
+  EXPECT_EQ(mjds(buffer, end), all(union_periods(a, b)));
+
+  const std::vector<P> unsorted{p(4, 6), p(0, 2), p(1, 3)};
+  end = normalize_periods(span<const P>(unsorted), buffer);
+  EXPECT_EQ(mjds(buffer, end), all(normalize_periods(unsorted)));
+
+  end = p(-1, 11).complement_of(span<const P>(a), buffer);
+  EXPECT_EQ(mjds(buffer, end), all(p(-1, 11).complement_of(a)));
+
+  // Empty inputs pass a null pointer through the ABI.
+  EXPECT_EQ(union_periods(span<const P>(), span<const P>(), buffer), buffer);
+  EXPECT_NO_THROW(validate_periods(span<const P>()));
+
+  EXPECT_THROW(validate_periods(span<const P>(unsorted)), PeriodListUnsortedError);
+  const auto checked = checked_union_periods(span<const P>(unsorted), span<const P>(b), buffer);
+  ASSERT_FALSE(checked);
+  EXPECT_EQ(checked.status(), TEMPOCH_STATUS_T_PERIOD_LIST_UNSORTED);
+  const auto ok = checked_normalize_periods(span<const P>(unsorted), buffer);
+  ASSERT_TRUE(ok);
+  EXPECT_EQ(*ok - buffer, 2);
+}
+
+TEST(Period, TimePeriodsKeepSplitEndpoints) {
+  using Tt = Time<scale::TT>;
+  using P = Period<Tt>;
+  static_assert(!P::stores_mjd);
+  static_assert(Period<ModifiedJulianDate<scale::TT>>::stores_mjd);
+  static_assert(
+      std::is_same_v<decltype(std::declval<const P &>().c_inner()), tempoch_period_mjd_t>);
+  static_assert(std::is_same_v<decltype(std::declval<const TTMjdPeriod &>().c_inner()),
+                               const tempoch_period_mjd_t &>);
+  static_assert(std::is_same_v<decltype(std::declval<const UTCPeriod &>().c_inner()),
+                               const tempoch_period_mjd_t &>);
+
+  // One nanosecond is far below the ~µs resolution of an MJD double near the present.
+  const Tt t0 = Tt::from_split_seconds(qtty::Second(8.0e8), qtty::Second(1.0e-10));
+  const Tt t1 = t0 + qtty::Second(1.0e-9);
+  const P period(t0, t1);
+
+  EXPECT_EQ(period.start(), t0);
+  EXPECT_EQ(period.end(), t1);
+  EXPECT_NEAR(period.duration<qtty::Second>().value(), 1.0e-9, 1.0e-15);
+  EXPECT_TRUE(period.contains(t0 + qtty::Second(0.5e-9)));
+  EXPECT_FALSE(period.contains(t1));
+  EXPECT_FALSE(period.contains(t0 - qtty::Second(0.5e-9)));
+  EXPECT_THROW(P(t1, t0), InvalidPeriodError);
+  EXPECT_EQ(P::checked_new(t1, t0).status(), TEMPOCH_STATUS_T_INVALID_PERIOD);
+
+  const P later(t0 + qtty::Second(0.5e-9), t0 + qtty::Second(2.0e-9));
+  const P overlap = period.intersection(later);
+  EXPECT_EQ(overlap.start(), later.start());
+  EXPECT_EQ(overlap.end(), t1);
+  ASSERT_EQ(period.union_with(later).size(), 1u);
+  EXPECT_EQ(period.union_with(later)[0].end(), later.end());
+
+  // The MJD view is what list operations pass to tempoch-ffi.
+  EXPECT_DOUBLE_EQ(period.c_inner().start_mjd, t0.to<format::MJD>().value());
+  const P day(Tt::from_encoded(ModifiedJulianDate<scale::TT>(60'000.0)),
+              Tt::from_encoded(ModifiedJulianDate<scale::TT>(60'001.0)));
+  const P next(Tt::from_encoded(ModifiedJulianDate<scale::TT>(60'000.5)),
+               Tt::from_encoded(ModifiedJulianDate<scale::TT>(60'002.0)));
+  const auto merged = normalize_periods(std::vector<P>{next, day});
+  ASSERT_EQ(merged.size(), 1u);
+  EXPECT_DOUBLE_EQ(merged[0].c_inner().start_mjd, 60'000.0);
+  EXPECT_DOUBLE_EQ(merged[0].c_inner().end_mjd, 60'002.0);
+}
+
+TEST(Period, CheckedListOperationsReportUnencodableTimeEndpoints) {
+  using Utc = Time<scale::UTC>;
+  using P = Period<Utc>;
+  const double inf = std::numeric_limits<double>::infinity();
+  const std::vector<P> unbounded = {P(Utc::from_c({-inf, 0.0}), Utc::from_c({inf, 0.0}))};
+  const std::vector<P> day = {P(Utc::from_split_seconds(qtty::Second(8.0e8)),
+                                Utc::from_split_seconds(qtty::Second(8.0e8 + 86'400.0)))};
+
+  // No finite MJD, or no split value decoded from one, spans the whole axis.
+  Result<std::vector<P>> normalized = Error{};
+  EXPECT_NO_THROW(normalized = checked_normalize_periods(unbounded));
+  EXPECT_FALSE(normalized);
+  Result<std::vector<P>> merged = Error{};
+  EXPECT_NO_THROW(merged = checked_union_periods(unbounded, day));
+  EXPECT_FALSE(merged);
+  EXPECT_NO_THROW((void)checked_validate_periods(unbounded));
+  EXPECT_THROW(normalize_periods(unbounded), TempochException);
+
+  EXPECT_TRUE(checked_normalize_periods(day));
+}
+
+TEST(Period, CivilPeriodsKeepCivilEndpoints) {
+  // Sub-microsecond fields do not survive an MJD double; the cached labels do.
+  const CivilTime t0(2026, 3, 14, 15, 9, 26, 535'897'932);
+  const CivilTime t1(2026, 3, 15, 6, 0, 0, 1);
+  const UTCPeriod period(t0, t1);
+
+  EXPECT_EQ(period.start().nanosecond, 535'897'932u);
+  EXPECT_EQ(period.start().second, 26);
+  EXPECT_EQ(period.end().hour, 6);
+  EXPECT_EQ(period.end().nanosecond, 1u);
+  EXPECT_TRUE(period.contains(CivilTime(2026, 3, 15, 0, 0, 0)));
+  EXPECT_FALSE(period.contains(t1));
+
+  const UTCPeriod later(CivilTime(2026, 3, 15, 0, 0, 0), CivilTime(2026, 3, 16, 0, 0, 0, 7));
+  const UTCPeriod overlap = period.intersection(later);
+  EXPECT_EQ(overlap.start().day, 15);
+  EXPECT_EQ(overlap.end().nanosecond, 1u);
+  const auto merged = period.union_with(later);
+  ASSERT_EQ(merged.size(), 1u);
+  EXPECT_EQ(merged[0].start().nanosecond, 535'897'932u);
+  EXPECT_EQ(merged[0].end().nanosecond, 7u);
+  EXPECT_THROW(UTCPeriod(t1, t0), InvalidPeriodError);
+}
+
+TEST(Period, CivilPeriodsOrderOnTheirLabelsWithinOneMjd) {
+  const CivilTime t1(2026, 3, 14, 15, 9, 26, 1);
+  const CivilTime t2(2026, 3, 14, 15, 9, 26, 2);
+  const CivilTime t3(2026, 3, 14, 15, 9, 26, 3);
+  ASSERT_EQ(TimeTraits<CivilTime>::to_mjd_value(t1), TimeTraits<CivilTime>::to_mjd_value(t3));
+
+  EXPECT_THROW(UTCPeriod(t2, t1), InvalidPeriodError);
+  EXPECT_EQ(UTCPeriod::checked_new(t2, t1).status(), TEMPOCH_STATUS_T_INVALID_PERIOD);
+
+  const UTCPeriod narrow(t1, t2);
+  const UTCPeriod wide(t1, t3);
+  EXPECT_TRUE(wide.contains(t2));
+  EXPECT_FALSE(narrow.contains(t2));
+  EXPECT_EQ(wide.intersection(narrow).end().nanosecond, 2u);
+  EXPECT_EQ(narrow.intersection(wide).end().nanosecond, 2u);
+  EXPECT_EQ(UTCPeriod(t2, t3).checked_intersection(narrow).status(),
+            TEMPOCH_STATUS_T_NO_INTERSECTION);
+  for (const auto &merged : {wide.union_with(narrow), narrow.union_with(wide)}) {
+    ASSERT_EQ(merged.size(), 1u);
+    EXPECT_EQ(merged[0].start().nanosecond, 1u);
+    EXPECT_EQ(merged[0].end().nanosecond, 3u);
+  }
+}
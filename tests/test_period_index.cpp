@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for the PeriodIndex interval index over overlapping periods.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+using Mjd = ModifiedJulianDate<scale::TT>;
+using MjdPeriod = Period<Mjd>;
+
+MjdPeriod p(double s, double e) { return MjdPeriod(Mjd(s), Mjd(e)); }
+
+/// Deterministic overlapping periods with quarter-day endpoints, so ties are common.
+std::vector<MjdPeriod> random_periods(std::size_t n) {
+  std::vector<MjdPeriod> out;
+  std::uint64_t state = 0x9e3779b97f4a7c15ull;
+  const auto next = [&] {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+  };
+  for (std::size_t i = 0; i < n; ++i) {
+    const double start = static_cast<double>(next() % 400) * 0.25;
+    const double length = static_cast<double>(next() % 24) * 0.25;
+    out.push_back(p(start, start + length));
+  }
+  return out;
+}
+
+} // namespace
+
+TEST(PeriodIndex, StabbingKeepsOverlappingPeriodsDistinct) {
+  const std::vector<MjdPeriod> list{p(5, 8), p(0, 10), p(2, 3), p(2, 3), p(4, 4), p(3, 6)};
+  const PeriodIndex index(list);
+  EXPECT_EQ(index.size(), 5u);
+
+  EXPECT_EQ(index.containing(Mjd(2.5)), (std::vector<std::size_t>{1, 2, 3}));
+  EXPECT_EQ(index.containing(Mjd(3.0)), (std::vector<std::size_t>{1, 5}));
+  EXPECT_EQ(index.containing(Mjd(5.0)), (std::vector<std::size_t>{1, 5, 0}));
+  EXPECT_EQ(index.containing(Mjd(4.0)), (std::vector<std::size_t>{1, 5}));
+  EXPECT_TRUE(index.containing(Mjd(10.0)).empty());
+  EXPECT_TRUE(index.containing(Mjd(-1.0)).empty());
+
+  EXPECT_EQ(index.overlapping(p(3, 5)), (std::vector<std::size_t>{1, 5}));
+  EXPECT_EQ(index.overlapping(p(8, 12)), (std::vector<std::size_t>{1}));
+  EXPECT_TRUE(index.overlapping(p(10, 12)).empty());
+  EXPECT_TRUE(index.overlapping(p(2.5, 2.5)).empty());
+
+  EXPECT_TRUE(PeriodIndex<Mjd>().containing(Mjd(0.0)).empty());
+}
+
+TEST(PeriodIndex, RejectsInvalidPeriods) {
+  const std::vector<MjdPeriod> bad{p(0, 1), MjdPeriod::from_c({2.0, 1.0})};
+  EXPECT_THROW(PeriodIndex<Mjd>{bad}, InvalidPeriodError);
+  EXPECT_EQ(PeriodIndex<Mjd>::checked_new(bad).status(), TEMPOCH_STATUS_T_INVALID_PERIOD);
+}
+
+TEST(PeriodIndex, MatchesLinearScan) {
+  const auto list = random_periods(2'000);
+  const PeriodIndex index(list);
+
+  for (int q = 0; q < 420; ++q) {
+    const double t = q * 0.25 - 1.0;
+    std::vector<std::size_t> want;
+    for (std::size_t i = 0; i < list.size(); ++i)
+      if (list[i].contains(Mjd(t)))
+        want.push_back(i);
+    auto got = index.containing(Mjd(t));
+    std::sort(got.begin(), got.end());
+    ASSERT_EQ(got, want) << "t = " << t;
+  }
+
+  for (int q = 0; q < 200; ++q) {
+    const MjdPeriod range = p(q * 0.5 - 1.0, q * 0.5 + (q % 7) * 0.75);
+    const double lo = range.c_inner().start_mjd;
+    const double hi = range.c_inner().end_mjd;
+    std::vector<std::size_t> want;
+    for (std::size_t i = 0; i < list.size(); ++i) {
+      const auto &c = list[i].c_inner();
+      if (std::max(c.start_mjd, lo) < std::min(c.end_mjd, hi))
+        want.push_back(i);
+    }
+    auto got = index.overlapping(range);
+    std::sort(got.begin(), got.end());
+    ASSERT_EQ(got, want) << "[" << lo << ", " << hi << ")";
+  }
+}
+
+TEST(PeriodIndex, TimePeriodsKeepSplitEndpoints) {
+  using Tt = Time<scale::TT>;
+  using P = Period<Tt>;
+  const Tt t0 = Tt::from_split_seconds(qtty::Second(8.0e8), qtty::Second(1.0e-10));
+  const Tt t1 = t0 + qtty::Second(1.0e-9);
+  const Tt t2 = t1 + qtty::Second(1.0e-9);
+  const Tt t3 = t2 + qtty::Second(1.0e-9);
+
+  const PeriodIndex<Tt> index({P(t1, t3), P(t0, t2)});
+  EXPECT_EQ(index.containing(t0), (std::vector<std::size_t>{1}));
+  EXPECT_EQ(index.containing(t1), (std::vector<std::size_t>{1, 0}));
+  EXPECT_EQ(index.containing(t2), (std::vector<std::size_t>{0}));
+  EXPECT_EQ(index.overlapping(P(t2, t3)), (std::vector<std::size_t>{0}));
+  EXPECT_EQ(PeriodIndex<Tt>::checked_new(std::vector<P>{P::from_c({1.0, 0.0})}).status(),
+            TEMPOCH_STATUS_T_INVALID_PERIOD);
+}
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for the normalized PeriodSet container.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+using Mjd = ModifiedJulianDate<scale::TT>;
+using MjdPeriod = Period<Mjd>;
+
+MjdPeriod p(double s, double e) { return MjdPeriod(Mjd(s), Mjd(e)); }
+
+std::vector<MjdPeriod> raw_list(const PeriodSet<Mjd> &set) { return set.to_vector(); }
+
+void expect_periods(const PeriodSet<Mjd> &set, const std::vector<std::pair<double, double>> &want) {
+  ASSERT_EQ(set.size(), want.size());
+  for (std::size_t i = 0; i < want.size(); ++i) {
+    EXPECT_EQ(set.starts()[i], want[i].first) << i;
+    EXPECT_EQ(set.ends()[i], want[i].second) << i;
+  }
+}
+
+} // namespace
+
+TEST(PeriodSet, ConstructionSortsMergesAndDropsEmptyPeriods) {
+  PeriodSet<Mjd> set({p(5, 6), p(0, 1), p(1, 2), p(3, 3), p(0.5, 1.5), p(4, 5.5)});
+  expect_periods(set, {{0, 2}, {4, 6}});
+  EXPECT_THROW(PeriodSet<Mjd>({MjdPeriod::from_c({2.0, 1.0})}), InvalidPeriodError);
+
+  const std::vector<MjdPeriod> bad{MjdPeriod::from_c({2.0, 1.0})};
+  EXPECT_EQ(PeriodSet<Mjd>::checked_new(bad).status(), TEMPOCH_STATUS_T_INVALID_PERIOD);
+}
+
+TEST(PeriodSet, MatchesNormalizePeriods) {
+  std::vector<MjdPeriod> list;
+  for (int i = 0; i < 200; ++i) {
+    const double s = 60000.0 + (i * 37 % 101) * 0.5;
+    list.push_back(p(s, s + 0.25 + (i % 7) * 0.3));
+  }
+  const auto normalized = normalize_periods(list);
+  const PeriodSet<Mjd> set(list);
+  ASSERT_EQ(set.size(), normalized.size());
+  for (std::size_t i = 0; i < set.size(); ++i) {
+    EXPECT_EQ(set[i].c_inner().start_mjd, normalized[i].c_inner().start_mjd);
+    EXPECT_EQ(set[i].c_inner().end_mjd, normalized[i].c_inner().end_mjd);
+  }
+}
+
+TEST(PeriodSet, FromSortedValidatesLikeValidatePeriods) {
+  expect_periods(PeriodSet<Mjd>::from_sorted(std::vector<MjdPeriod>{p(0, 1), p(1, 2), p(3, 4)}),
+                 {{0, 2}, {3, 4}});
+  EXPECT_THROW(PeriodSet<Mjd>::from_sorted(std::vector<MjdPeriod>{p(2, 3), p(0, 1)}),
+               PeriodListUnsortedError);
+  EXPECT_THROW(PeriodSet<Mjd>::from_sorted(std::vector<MjdPeriod>{p(0, 2), p(1, 3)}),
+               PeriodListOverlappingError);
+}
+
+TEST(PeriodSet, PointQueriesAreHalfOpen) {
+  const PeriodSet<Mjd> set({p(0, 1), p(2, 3), p(5, 8)});
+
+  EXPECT_TRUE(set.contains(Mjd(0.0)));
+  EXPECT_FALSE(set.contains(Mjd(1.0)));
+  EXPECT_FALSE(set.contains(Mjd(-1.0)));
+  EXPECT_TRUE(set.contains(Mjd(7.999)));
+  EXPECT_FALSE(set.contains(Mjd(8.0)));
+
+  ASSERT_TRUE(set.covering_period(Mjd(6.0)).has_value());
+  EXPECT_EQ(set.covering_period(Mjd(6.0))->c_inner().start_mjd, 5.0);
+  EXPECT_FALSE(set.covering_period(Mjd(4.0)).has_value());
+
+  EXPECT_EQ(set.next_start_after(Mjd(-3.0))->value(), 0.0);
+  EXPECT_EQ(set.next_start_after(Mjd(2.0))->value(), 5.0);
+  EXPECT_FALSE(set.next_start_after(Mjd(5.0)).has_value());
+}
+
+TEST(PeriodSet, AlgebraMatchesListOperations) {
+  const PeriodSet<Mjd> a({p(0, 2), p(4, 6), p(8, 12)});
+  const PeriodSet<Mjd> b({p(1, 5), p(6, 9), p(11, 11.5), p(13, 14)});
+
+  expect_periods(a | b, {{0, 12}, {13, 14}});
+  expect_periods(a & b, {{1, 2}, {4, 5}, {8, 9}, {11, 11.5}});
+  expect_periods(a - b, {{0, 1}, {5, 6}, {9, 11}, {11.5, 12}});
+  expect_periods(b - a, {{2, 4}, {6, 8}, {13, 14}});
+  expect_periods(a.complement(p(-1, 10)), {{-1, 0}, {2, 4}, {6, 8}});
+
+  const auto union_list = union_periods(raw_list(a), raw_list(b));
+  EXPECT_EQ((a | b), PeriodSet<Mjd>(union_list));
+  const auto inter_list = intersect_periods(raw_list(a), raw_list(b));
+  EXPECT_EQ((a & b), PeriodSet<Mjd>(inter_list));
+  EXPECT_NEAR((a - b).total_duration().value(), 4.5, 1e-12);
+}
+
+TEST(PeriodSet, InsertMergesNeighbours) {
+  PeriodSet<Mjd> set({p(0, 1), p(2, 3), p(4, 5), p(7, 8)});
+  set.insert(p(1, 4));
+  expect_periods(set, {{0, 5}, {7, 8}});
+  set.insert(p(5.5, 6));
+  expect_periods(set, {{0, 5}, {5.5, 6}, {7, 8}});
+  set.insert(p(-2, -1));
+  set.insert(p(9, 9));
+  expect_periods(set, {{-2, -1}, {0, 5}, {5.5, 6}, {7, 8}});
+}
+
+TEST(PeriodSet, TimePeriodsKeepSplitEndpoints) {
+  using Utc = Time<scale::UTC>;
+  using P = Period<Utc>;
+  static_assert(std::is_same_v<PeriodSet<Utc>::endpoint_type, tempoch_time_t>);
+  // Nanosecond steps collapse in an MJD double; the set keys on split seconds.
+  const Utc t0 = Utc::from_split_seconds(qtty::Second(8.0e8), qtty::Second(1.0e-10));
+  const Utc t1 = t0 + qtty::Second(1.0e-9);
+  const Utc t2 = t1 + qtty::Second(1.0e-9);
+  const Utc t3 = t2 + qtty::Second(1.0e-9);
+
+  const PeriodSet<Utc> set({P(t2, t3), P(t0, t1)});
+  ASSERT_EQ(set.size(), 2u);
+  EXPECT_EQ(set[0].end(), t1);
+  EXPECT_EQ(set[1].start(), t2);
+  EXPECT_TRUE(set.contains(t0));
+  EXPECT_FALSE(set.contains(t1));
+  EXPECT_EQ(*set.next_start_after(t1), t2);
+  EXPECT_EQ((set | PeriodSet<Utc>({P(t1, t2)})).size(), 1u);
+  EXPECT_EQ((set - PeriodSet<Utc>({P(t0, t3)})).size(), 0u);
+
+  // No endpoint is converted, so one that has no MJD does not fail construction.
+  const double inf = std::numeric_limits<double>::infinity();
+  const std::vector<P> unbounded = {P(Utc::from_c({-inf, 0.0}), Utc::from_c({inf, 0.0}))};
+  const auto whole = PeriodSet<Utc>::checked_new(unbounded);
+  ASSERT_TRUE(whole);
+  EXPECT_TRUE(whole->contains(t0));
+}
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for the streaming sweep-line period algebra.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+using Mjd = ModifiedJulianDate<scale::TT>;
+using MjdPeriod = Period<Mjd>;
+
+MjdPeriod p(double s, double e) { return MjdPeriod(Mjd(s), Mjd(e)); }
+
+/// Single-pass iterator that synthesises one period per increment, like a file reader.
+class GeneratedPeriods {
+public:
+  using iterator_category = std::input_iterator_tag;
+  using value_type = MjdPeriod;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const MjdPeriod *;
+  using reference = MjdPeriod;
+
+  GeneratedPeriods() = default;
+  GeneratedPeriods(std::size_t count, double step, double length, double offset)
+      : remaining_(count), step_(step), length_(length), start_(offset) {}
+
+  MjdPeriod operator*() const { return p(start_, start_ + length_); }
+  GeneratedPeriods &operator++() {
+    --remaining_;
+    start_ += step_;
+    return *this;
+  }
+  bool operator==(const GeneratedPeriods &other) const { return remaining_ == other.remaining_; }
+  bool operator!=(const GeneratedPeriods &other) const { return !(*this == other); }
+
+private:
+  std::size_t remaining_ = 0;
+  double step_ = 1.0;
+  double length_ = 0.5;
+  double start_ = 0.0;
+};
+
+/// Sorted, disjoint periods on a quarter-day grid, with some touching neighbours.
+std::vector<MjdPeriod> random_sorted(std::size_t n, std::uint64_t seed) {
+  std::vector<MjdPeriod> out;
+  double cursor = 0.0;
+  for (std::size_t i = 0; i < n; ++i) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    cursor += static_cast<double>(seed % 4) * 0.25;
+    const double end = cursor + static_cast<double>(1 + (seed >> 8) % 6) * 0.25;
+    out.push_back(p(cursor, end));
+    cursor = end;
+  }
+  return out;
+}
+
+template <typename Sweep> std::vector<std::pair<double, double>> drain(Sweep &&sweep) {
+  std::vector<std::pair<double, double>> out;
+  for (const auto &period : sweep)
+    out.emplace_back(period.c_inner().start_mjd, period.c_inner().end_mjd);
+  EXPECT_EQ(sweep.status(), TEMPOCH_STATUS_T_OK);
+  return out;
+}
+
+std::vector<std::pair<double, double>> mjds(const PeriodSet<Mjd> &set) {
+  std::vector<std::pair<double, double>> out;
+  for (std::size_t i = 0; i < set.size(); ++i)
+    out.emplace_back(set.starts()[i], set.ends()[i]);
+  return out;
+}
+
+} // namespace
+
+TEST(PeriodSweep, MatchesPeriodSetAlgebra) {
+  for (std::uint64_t seed : {1ull, 7ull, 12345ull}) {
+    const auto a = random_sorted(300, seed);
+    const auto b = random_sorted(250, seed * 31 + 5);
+    const PeriodSet<Mjd> sa(a), sb(b);
+
+    EXPECT_EQ(drain(sweep_union(a.begin(), a.end(), b.begin(), b.end())), mjds(sa | sb));
+    // Intersection and difference may leave touching pieces; compare after merging.
+    std::vector<MjdPeriod> inter_list, diff_list;
+    sweep_intersection(a.begin(), a.end(), b.begin(), b.end())
+        .copy_to(std::back_inserter(inter_list));
+    sweep_difference(a.begin(), a.end(), b.begin(), b.end()).copy_to(std::back_inserter(diff_list));
+    EXPECT_FALSE(inter_list.empty());
+    EXPECT_EQ(mjds(PeriodSet<Mjd>(inter_list)), mjds(sa & sb));
+    EXPECT_EQ(mjds(PeriodSet<Mjd>(diff_list)), mjds(sa - sb));
+  }
+}
+
+TEST(PeriodSweep, StreamsSinglePassInputs) {
+  // Day-long windows every 2 days, minus 6-hour outages every 3 days.
+  auto gaps = sweep_difference(GeneratedPeriods(4, 2.0, 1.0, 0.0), GeneratedPeriods(),
+                               GeneratedPeriods(3, 3.0, 0.25, 0.5), GeneratedPeriods());
+  EXPECT_EQ(drain(gaps), (std::vector<std::pair<double, double>>{
+                             {0, 0.5}, {0.75, 1}, {2, 3}, {4, 5}, {6, 6.5}, {6.75, 7}}));
+}
+
+TEST(PeriodSweep, NWayUnionAndIntersection) {
+  using Range = std::pair<std::vector<MjdPeriod>::const_iterator,
+                          std::vector<MjdPeriod>::const_iterator>;
+  const std::vector<MjdPeriod> a{p(0, 4), p(6, 10)};
+  const std::vector<MjdPeriod> b{p(1, 2), p(3, 7)};
+  const std::vector<MjdPeriod> c{p(1.5, 8), p(10, 11)};
+  const std::vector<Range> inputs{{a.begin(), a.end()}, {b.begin(), b.end()}, {c.begin(), c.end()}};
+
+  EXPECT_EQ(drain(sweep_union(inputs)), (std::vector<std::pair<double, double>>{{0, 11}}));
+  EXPECT_EQ(drain(sweep_intersection(inputs)),
+            (std::vector<std::pair<double, double>>{{1.5, 2}, {3, 4}, {6, 7}}));
+  EXPECT_TRUE(drain(sweep_intersection(std::vector<Range>{})).empty());
+}
+
+TEST(PeriodSweep, ValidatesSortOrderIncrementally) {
+  const std::vector<MjdPeriod> sorted{p(0, 1), p(2, 3)};
+  const std::vector<MjdPeriod> unsorted{p(0, 1), p(5, 6), p(2, 3)};
+  const std::vector<MjdPeriod> overlapping{p(0, 2), p(1, 3)};
+
+  auto sweep = sweep_union(sorted.begin(), sorted.end(), unsorted.begin(), unsorted.end());
+  std::vector<MjdPeriod> out;
+  EXPECT_THROW(sweep.copy_to(std::back_inserter(out)), PeriodListUnsortedError);
+  EXPECT_EQ(sweep.status(), TEMPOCH_STATUS_T_PERIOD_LIST_UNSORTED);
+  EXPECT_FALSE(sweep.next());
+
+  auto diff =
+      sweep_difference(overlapping.begin(), overlapping.end(), sorted.begin(), sorted.end());
+  while (diff.next()) {
+  }
+  EXPECT_EQ(diff.status(), TEMPOCH_STATUS_T_PERIOD_LIST_OVERLAPPING);
+  EXPECT_THROW(diff.check(), PeriodListOverlappingError);
+}
+
+TEST(PeriodSweep, TimePeriodsKeepSplitEndpoints) {
+  using Tt = Time<scale::TT>;
+  using P = Period<Tt>;
+  const Tt t0 = Tt::from_split_seconds(qtty::Second(8.0e8), qtty::Second(1.0e-10));
+  const Tt t1 = t0 + qtty::Second(1.0e-9);
+  const Tt t2 = t1 + qtty::Second(1.0e-9);
+  const Tt t3 = t2 + qtty::Second(1.0e-9);
+
+  const std::vector<P> a = {P(t0, t3)};
+  const std::vector<P> b = {P(t1, t2)};
+  std::vector<P> gaps;
+  sweep_difference(a.begin(), a.end(), b.begin(), b.end()).copy_to(std::back_inserter(gaps));
+  ASSERT_EQ(gaps.size(), 2u);
+  EXPECT_EQ(gaps[0].end(), t1);
+  EXPECT_EQ(gaps[1].start(), t2);
+  EXPECT_EQ(gaps[1].end(), t3);
+}
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for the non-throwing `checked_*` API and `Result<T>`.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace tempoch;
+
+TEST(Result, HoldsValueOrError) {
+  Result<int> ok(7);
+  ASSERT_TRUE(ok);
+  EXPECT_EQ(ok.status(), TEMPOCH_STATUS_T_OK);
+  EXPECT_EQ(*ok, 7);
+  EXPECT_EQ(ok.map([](int v) { return v * 2.0; }).value(), 14.0);
+
+  Result<int> failed(Error{TEMPOCH_STATUS_T_UT1_HORIZON_EXCEEDED, "op"});
+  ASSERT_FALSE(failed);
+  EXPECT_EQ(failed.status(), TEMPOCH_STATUS_T_UT1_HORIZON_EXCEEDED);
+  EXPECT_STREQ(failed.error().message(), "UT1 horizon exceeded");
+  EXPECT_STREQ(failed.error().operation, "op");
+  EXPECT_EQ(failed.value_or(-1), -1);
+  EXPECT_FALSE(failed.to_optional().has_value());
+  EXPECT_FALSE(failed.and_then([](int v) { return Result<int>(v); }));
+  EXPECT_THROW(failed.value(), Ut1HorizonExceededError);
+
+  EXPECT_TRUE(Result<void>::from_status(TEMPOCH_STATUS_T_OK, "op"));
+  EXPECT_THROW(Result<void>::from_status(TEMPOCH_STATUS_T_INVALID_PERIOD, "op").value(),
+               InvalidPeriodError);
+}
+
+TEST(Result, CheckedConversionsMatchThrowingOnes) {
+  const auto utc = Time<scale::UTC>::from_civil({2026, 7, 15, 22, 0, 0});
+  const auto tt = utc.checked_to<scale::TT>();
+  ASSERT_TRUE(tt);
+  EXPECT_EQ(*tt, utc.to<scale::TT>());
+
+  const auto jd = utc.checked_to<scale::TT, format::JD>();
+  ASSERT_TRUE(jd);
+  EXPECT_EQ(jd->value(), (utc.to<scale::TT, format::JD>().value()));
+
+  const auto civil = utc.checked_to_civil();
+  ASSERT_TRUE(civil);
+  EXPECT_EQ(civil->hour, 22);
+
+  const auto mjd = jd->checked_to<format::MJD>();
+  ASSERT_TRUE(mjd);
+  const auto back = Time<scale::TT>::checked_from_encoded(*mjd);
+  ASSERT_TRUE(back);
+  EXPECT_NEAR((*back - *tt).value(), 0.0, 1e-3);
+}
+
+TEST(Result, FailuresAreReportedWithoutThrowing) {
+  const auto far_future = Time<scale::TT>::from_encoded(JulianDate<scale::TT>(2'500'000.0));
+  const auto ctx = TimeContext::with_builtin_eop();
+  Result<Time<scale::UT1>> ut1 = far_future.checked_to_with<scale::UT1>(ctx);
+  ASSERT_FALSE(ut1);
+  EXPECT_EQ(ut1.status(), TEMPOCH_STATUS_T_UT1_HORIZON_EXCEEDED);
+  EXPECT_STREQ(ut1.error().operation, "tempoch_time_scale_convert");
+  EXPECT_FALSE(far_future.try_to<scale::UT1>().has_value());
+
+  const auto pre_definition = Time<scale::UTC>::checked_from_civil(CivilTime(1900, 1, 1));
+  ASSERT_FALSE(pre_definition);
+  EXPECT_EQ(pre_definition.status(), TEMPOCH_STATUS_T_CONVERSION_FAILED);
+
+  const auto non_finite = Time<scale::TT>::checked_from_split_seconds(qtty::Second(std::nan("")));
+  EXPECT_EQ(non_finite.status(), TEMPOCH_STATUS_T_CONVERSION_FAILED);
+
+  // A finite JD whose J2000-second count overflows comes back as an error.
+  const JulianDate<scale::TT> huge(1.0e305);
+  const auto seconds = huge.checked_to<format::J2000s>();
+  ASSERT_FALSE(seconds);
+  EXPECT_EQ(seconds.status(), TEMPOCH_STATUS_T_CONVERSION_FAILED);
+  EXPECT_STREQ(seconds.error().operation, "tempoch_time_to_format");
+  EXPECT_FALSE(huge.try_to<format::J2000s>().has_value());
+  EXPECT_TRUE(huge.checked_to<format::MJD>());
+}
+
+TEST(Result, CheckedGnssWeekAndPeriods) {
+  const auto week = checked_to_gnss_week(Time<scale::GPST>::gps_epoch() + qtty::Day(8.0));
+  ASSERT_TRUE(week);
+  EXPECT_EQ(week->week, 1u);
+  const auto back = checked_from_gnss_week<scale::GPST>(*week);
+  ASSERT_TRUE(back);
+  EXPECT_NEAR((*back - Time<scale::GPST>::gps_epoch()).value(), 8.0 * 86'400.0, 1e-6);
+
+  using P = Period<ModifiedJulianDate<scale::TT>>;
+  const auto inverted = P::checked_new(ModifiedJulianDate<scale::TT>(60'010.0),
+                                       ModifiedJulianDate<scale::TT>(60'000.0));
+  EXPECT_EQ(inverted.status(), TEMPOCH_STATUS_T_INVALID_PERIOD);
+
+  const auto a = P::checked_new(ModifiedJulianDate<scale::TT>(60'000.0),
+                                ModifiedJulianDate<scale::TT>(60'001.0));
+  const auto b = P::checked_new(ModifiedJulianDate<scale::TT>(60'002.0),
+                                ModifiedJulianDate<scale::TT>(60'003.0));
+  ASSERT_TRUE(a && b);
+  EXPECT_EQ(a->checked_intersection(*b).status(), TEMPOCH_STATUS_T_NO_INTERSECTION);
+
+  const std::vector<P> unsorted{*b, *a};
+  EXPECT_EQ(checked_validate_periods(unsorted).status(), TEMPOCH_STATUS_T_PERIOD_LIST_UNSORTED);
+  const auto normalized = checked_normalize_periods(unsorted);
+  ASSERT_TRUE(normalized);
+  EXPECT_EQ(normalized->size(), 2u);
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <tempoch/tempoch.hpp>
 
+#include <chrono>
+#include <cmath>
 #include <type_traits>
 
 using namespace tempoch;
@@ -83,6 +85,83 @@ TEST(Time, ArithmeticIsAffineAndSecondBased) {
   EXPECT_NEAR(tt.split_seconds().first.value(), 10.0, 1e-12);
 }
 
+TEST(Time, InlineArithmeticMatchesFfi) {
+  const double starts[] = {-3.2e9, -725'803'167.816, 0.0, 123'456'789.123, 835'000'000.5};
+  const double deltas[] = {-86'400.25, -1.0e-9, 0.001, 37.5, 1.0e7};
+  for (double start : starts) {
+    const auto t = Time<scale::TDB>::from_raw_j2000_seconds(qtty::Second(start));
+    for (double delta : deltas) {
+      tempoch_time_t ffi{};
+      ASSERT_EQ(tempoch_time_add_seconds(t.c_inner(), qtty_quantity_t{delta, 1}, &ffi),
+                TEMPOCH_STATUS_T_OK);
+      const auto sum = t + qtty::Second(delta);
+      EXPECT_NEAR(detail::split_difference(sum.c_inner(), ffi), 0.0, 1e-12);
+      EXPECT_NEAR((sum - t).value(), delta, 1e-12 + std::abs(delta) * 1e-15);
+    }
+  }
+  const auto t = Time<scale::TT>::from_raw_j2000_seconds(qtty::Second(0.5));
+  EXPECT_EQ((t + qtty::Day(2.0) - t).value(), 172'800.0);
+  EXPECT_EQ((t + qtty::JulianCentury(1.0) - t).value(), 3'155'760'000.0);
+  static_assert(detail::has_native_unit_v<qtty::Minute>);
+  EXPECT_EQ((t + qtty::Minute(90.0) - t).value(), 5'400.0);
+  EXPECT_EQ((t - qtty::Minute(0.5)).total_seconds().value(), -29.5);
+}
+
+TEST(Time, SteppingKeepsTheRoundingErrorInTheLowPart) {
+  const auto start = Time<scale::TT>::from_raw_j2000_seconds(qtty::Second(8.0e8));
+  auto t = start;
+  for (int i = 0; i < 1'000'000; ++i)
+    t += qtty::Second(0.001);
+  EXPECT_NEAR((t - start).value(), 1'000.0, 1e-9);
+  t -= qtty::Second(1'000.0);
+  EXPECT_NEAR((t - start).value(), 0.0, 1e-9);
+}
+
+namespace {
+// Built entirely at compile time: no FFI call during static initialisation.
+constexpr Time<scale::TT> kSchedule[] = {
+    Time<scale::TT>(),
+    Time<scale::TT>::from_split_seconds(qtty::Second(86'400.0), qtty::Second(0.5)),
+    Time<scale::TT>::gps_epoch(),
+};
+} // namespace
+
+TEST(Time, ConstexprConstructionAndEpochs) {
+  static_assert(kSchedule[0] == Time<scale::TT>::j2000());
+  static_assert(kSchedule[2] < kSchedule[0] && kSchedule[0] < kSchedule[1]);
+  static_assert(kSchedule[1].c_inner().hi_seconds == 86'400.5);
+  static_assert(Time<scale::GPST>::gps_epoch().c_inner().hi_seconds == -630'763'200.0);
+  static_assert(Time<scale::TAI>::gps_epoch().c_inner().hi_seconds == -630'763'181.0);
+  static_assert(JulianDate<scale::TT>::J2000().value() == 2'451'545.0);
+  static_assert(ModifiedJulianDate<scale::TDB>::J2000().value() == 51'544.5);
+  static_assert(JulianDate<scale::TT>::J2000() < JulianDate<scale::TT>(2'451'546.0));
+
+  EXPECT_EQ(Time<scale::UTC>::gps_epoch().to_civil().year, 1980);
+  EXPECT_EQ(Time<scale::UTC>::gps_epoch().to<scale::GPST>(), Time<scale::GPST>::gps_epoch());
+  EXPECT_EQ(Time<scale::UTC>::unix_epoch(), Time<scale::UTC>::from_encoded(UnixTime(0.0)));
+  EXPECT_EQ(Time<scale::UTC>::unix_epoch().to<format::Unix>().value(), 0.0);
+  EXPECT_THROW(Time<scale::TT>::from_split_seconds(qtty::Second(std::nan(""))),
+               ConversionFailedError);
+}
+
+TEST(Time, NowReadsTheSystemClock) {
+  const auto unix_now = [] {
+    return std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+  };
+  const double before = unix_now();
+  const auto utc = Time<scale::UTC>::now();
+  const double after = unix_now();
+  EXPECT_GE(utc.to<format::Unix>().value(), before - 1e-3);
+  EXPECT_LE(utc.to<format::Unix>().value(), after + 1e-3);
+  EXPECT_LE(utc, Time<scale::UTC>::now());
+
+  // Kernel CLOCK_TAI or the UTC stamp plus TAI − UTC: either way the same instant.
+  const auto tai = Time<scale::TAI>::now();
+  EXPECT_NEAR((tai - utc.to<scale::TAI>()).value(), 0.0, 1e-3);
+  EXPECT_NEAR((Time<scale::TAI>::now() - tai).value(), 0.0, 1e-3);
+}
+
 TEST(Time, TtJulianDateConvenienceUtcRoundtrip) {
   auto jd = JulianDate<scale::TT>::from_utc({2026, 7, 15, 22, 0, 0});
   auto utc = jd.to_utc();
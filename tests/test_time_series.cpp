@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for the memory-mapped time-series files.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+#include <tempoch/time_series.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+using Tt = Time<scale::TT>;
+
+std::string temp_path(const char *name) { return ::testing::TempDir() + name; }
+
+std::vector<Tt> hourly(std::size_t n) {
+  std::vector<Tt> out;
+  for (std::size_t i = 0; i < n; ++i)
+    out.push_back(Tt::from_split_seconds(qtty::Second(8.0e8 + 3'600.0 * static_cast<double>(i)),
+                                         qtty::Second(1.0e-10 * static_cast<double>(i % 7))));
+  return out;
+}
+
+} // namespace
+
+TEST(TimeSeries, RoundTripsRecordsInPlace) {
+  const std::string path = temp_path("tempoch_roundtrip.tts");
+  const auto times = hourly(1'000);
+  write_time_series(path, span<const Tt>(times), TimeSeriesWriteOptions{64, true});
+
+  const auto file = MappedTimeSeries<scale::TT>::open(path);
+  ASSERT_EQ(file.size(), times.size());
+  EXPECT_TRUE(file.sorted());
+  EXPECT_TRUE(file.has_zone_maps());
+  EXPECT_EQ(file.block_count(), 16u);
+  EXPECT_EQ(file.block(15).size(), 1'000u - 15 * 64);
+  EXPECT_EQ(file.fingerprint(), time_data_fingerprint());
+  EXPECT_TRUE(file.matches_active_data());
+  for (std::size_t i = 0; i < times.size(); ++i)
+    ASSERT_EQ(file.times()[i], times[i]) << i;
+
+  const auto bounds = file.block_bounds(3);
+  EXPECT_EQ(bounds.first, times[3 * 64]);
+  EXPECT_EQ(bounds.second, times[4 * 64 - 1]);
+  std::remove(path.c_str());
+}
+
+TEST(TimeSeries, RangeScansSkipBlocksOutsideTheZone) {
+  const std::string path = temp_path("tempoch_scan.tts");
+  auto times = hourly(1'000);
+  std::swap(times[10], times[20]); // unsorted, but block 0 keeps the same zone
+  write_time_series(path, span<const Tt>(times), TimeSeriesWriteOptions{100, true});
+  const auto file = MappedTimeSeries<scale::TT>::open(path);
+  EXPECT_FALSE(file.sorted());
+  EXPECT_THROW((void)file.range(times[0], times[1]), TempochException);
+
+  std::vector<std::size_t> visited;
+  std::size_t hits = 0;
+  file.for_each_block_overlapping(times[250], times[420], [&](std::size_t first, auto block) {
+    visited.push_back(first);
+    for (const auto &t : block)
+      hits += (!(t < times[250]) && t < times[420]) ? 1 : 0;
+  });
+  EXPECT_EQ(visited, (std::vector<std::size_t>{200, 300, 400}));
+  EXPECT_EQ(hits, 170u);
+
+  const std::string sorted_path = temp_path("tempoch_sorted.tts");
+  const auto sorted = hourly(500);
+  write_time_series(sorted_path, span<const Tt>(sorted), TimeSeriesWriteOptions{128, false});
+  const auto sorted_file = MappedTimeSeries<scale::TT>::open(sorted_path);
+  EXPECT_FALSE(sorted_file.has_zone_maps());
+  const auto slice = sorted_file.range(sorted[100], sorted[150]);
+  ASSERT_EQ(slice.size(), 50u);
+  EXPECT_EQ(slice[0], sorted[100]);
+  std::size_t blocks = 0;
+  sorted_file.for_each_block_overlapping(sorted[0], sorted[1],
+                                         [&](std::size_t, auto) { ++blocks; });
+  EXPECT_EQ(blocks, sorted_file.block_count());
+  std::remove(path.c_str());
+  std::remove(sorted_path.c_str());
+}
+
+TEST(TimeSeries, RejectsMismatchedAndDamagedFiles) {
+  const std::string path = temp_path("tempoch_damaged.tts");
+  const auto times = hourly(10);
+  write_time_series(path, span<const Tt>(times));
+
+  EXPECT_THROW(MappedTimeSeries<scale::TAI>::open(path), TempochException);
+  EXPECT_THROW(MappedTimeSeries<scale::TT>::open(temp_path("tempoch_missing.tts")),
+               TempochException);
+
+  std::string bytes;
+  {
+    std::ifstream in(path, std::ios::binary);
+    bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+  const auto rewrite = [&](const std::string &content) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(content.data(), static_cast<std::streamsize>(content.size()));
+  };
+  rewrite(bytes.substr(0, bytes.size() - 40)); // cuts into the zone map
+  EXPECT_THROW(MappedTimeSeries<scale::TT>::open(path), TempochException);
+  rewrite(bytes.substr(0, 64 + 16 * 5)); // cuts into the records
+  EXPECT_THROW(MappedTimeSeries<scale::TT>::open(path), TempochException);
+  std::string bad_magic = bytes;
+  bad_magic[0] = 'X';
+  rewrite(bad_magic);
+  EXPECT_THROW(MappedTimeSeries<scale::TT>::open(path), TempochException);
+  rewrite(bytes);
+  EXPECT_EQ(MappedTimeSeries<scale::TT>::open(path).size(), 10u);
+
+  write_time_series(path, span<const Tt>());
+  const auto empty = MappedTimeSeries<scale::TT>::open(path);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.block_count(), 0u);
+  std::remove(path.c_str());
+}
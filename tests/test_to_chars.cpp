@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: AGPL-3.0-only
+// Copyright (C) 2026 Vallés Puig, Ramon
+
+// Tests for the buffer-based text formatting.
+
+#include <gtest/gtest.h>
+#include <tempoch/tempoch.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace tempoch;
+
+namespace {
+
+template <typename T, typename... Args> std::string text(const T &value, Args... args) {
+  char buf[64];
+  const auto r = to_chars(buf, buf + sizeof buf, value, args...);
+  EXPECT_EQ(r.ec, std::errc{});
+  return std::string(buf, r.ptr);
+}
+
+} // namespace
+
+TEST(ToChars, CivilIso8601) {
+  const CivilTime c(2026, 7, 5, 9, 3, 7, 250'000'000);
+  EXPECT_EQ(text(c), "2026-07-05T09:03:07.250000000Z");
+  EXPECT_EQ(text(c, 3), "2026-07-05T09:03:07.250Z");
+  EXPECT_EQ(text(c, 0), "2026-07-05T09:03:07Z");
+  EXPECT_EQ(text(CivilTime(2016, 12, 31, 23, 59, 60, 999'999'999), 2),
+            "2016-12-31T23:59:60.99Z"); // truncated, never rounded into the next minute
+  EXPECT_EQ(text(CivilTime(44, 3, 15), 0), "0044-03-15T00:00:00Z");
+  EXPECT_EQ(text(CivilTime(-44, 3, 15), 0), "-0044-03-15T00:00:00Z");
+  EXPECT_EQ(text(CivilTime(12'026, 1, 1), 0), "+12026-01-01T00:00:00Z");
+
+  // Round trip through the parser.
+  const auto back = parse_iso8601(text(c));
+  ASSERT_TRUE(back);
+  EXPECT_EQ(back->nanosecond, c.nanosecond);
+  EXPECT_EQ(back->second, c.second);
+}
+
+TEST(ToChars, UtcTimeUsesCivilLabel) {
+  const auto utc = Time<scale::UTC>::from_civil(CivilTime(2026, 7, 15, 22, 0, 0, 500'000'000));
+  EXPECT_EQ(text(utc, 1), "2026-07-15T22:00:00.5Z");
+}
+
+TEST(ToChars, EncodedFixedPoint) {
+  EXPECT_EQ(text(ModifiedJulianDate<scale::TT>(60'000.5), 6), "60000.500000");
+  EXPECT_EQ(text(JulianDate<scale::TT>(2'451'545.0), 0), "2451545");
+  EXPECT_EQ(text(ModifiedJulianDate<scale::TT>(0.9999996), 6), "1.000000");
+  EXPECT_EQ(text(ModifiedJulianDate<scale::TT>(-0.25), 2), "-0.25");
+  EXPECT_EQ(text(ModifiedJulianDate<scale::TT>(-0.001), 2), "0.00");
+  EXPECT_EQ(text(ModifiedJulianDate<scale::TT>(51'544.123456789), 9), "51544.123456789");
+
+  char buf[kFixedDecimalMaxChars];
+  EXPECT_EQ(to_chars(buf, buf + sizeof buf, ModifiedJulianDate<scale::TT>(1.0), 16).ec,
+            std::errc::invalid_argument);
+  EXPECT_EQ(to_chars(buf, buf + sizeof buf, ModifiedJulianDate<scale::TT>(1.0e300), 3).ec,
+            std::errc::invalid_argument);
+  EXPECT_EQ(to_chars(buf, buf + sizeof buf, ModifiedJulianDate<scale::TT>(-9.99e18), 15).ec,
+            std::errc{});
+}
+
+TEST(ToChars, GnssWeek) {
+  EXPECT_EQ(text(GnssWeek{2'345, 3'600, 500'000'000}, 3), "2345 003600.500");
+  EXPECT_EQ(text(GnssWeek{0, 604'799, 999'999'999}), "0 604799.999999999");
+  EXPECT_EQ(text(GnssWeek{0xFFFFFFFFu, 604'799, 999'999'999}).size(), kGnssWeekMaxChars);
+}
+
+TEST(ToChars, ReportsShortBuffers) {
+  char buf[kIso8601MaxChars];
+  const CivilTime c(2026, 7, 5);
+  EXPECT_EQ(to_chars(buf, buf + 20, c).ec, std::errc::value_too_large);
+  EXPECT_EQ(to_chars(buf, buf + 20, c, 0).ec, std::errc{});
+  EXPECT_EQ(to_chars(buf, buf + sizeof buf, CivilTime(-2'147'483'647 - 1, 12, 31, 23, 59, 60,
+                                                      999'999'999))
+                .ptr,
+            buf + kIso8601MaxChars);
+  EXPECT_EQ(to_chars(buf, buf + sizeof buf, c, 10).ec, std::errc::invalid_argument);
+}
+
+TEST(ToChars, RejectsOutOfRangeFieldsWithoutWriting) {
+  // A canary right after the buffer catches any write past `last`.
+  char buf[31];
+  const auto rejects = [&buf](const auto &value, int precision) {
+    std::fill(std::begin(buf), std::end(buf), '#');
+    const auto r = to_chars(buf, buf + 30, value, precision);
+    return r.ec == std::errc::invalid_argument && r.ptr == buf && buf[0] == '#' && buf[30] == '#';
+  };
+  EXPECT_TRUE(rejects(CivilTime(2026, 1, 1, 0, 0, 0, 1'000'000'000), 9));
+  EXPECT_TRUE(rejects(CivilTime(2026, 200, 1), 9));
+  EXPECT_TRUE(rejects(CivilTime(2026, 0, 1), 0));
+  EXPECT_TRUE(rejects(CivilTime(2026, 1, 0), 0));
+  EXPECT_TRUE(rejects(CivilTime(2026, 1, 32), 0));
+  EXPECT_TRUE(rejects(CivilTime(2026, 1, 1, 24), 0));
+  EXPECT_TRUE(rejects(CivilTime(2026, 1, 1, 0, 60), 0));
+  EXPECT_TRUE(rejects(CivilTime(2026, 1, 1, 0, 0, 61), 0));
+  EXPECT_TRUE(rejects(GnssWeek{2'345, 604'800, 0}, 9));
+  EXPECT_TRUE(rejects(GnssWeek{2'345, 0xFFFFFFFFu, 0}, 9));
+  EXPECT_TRUE(rejects(GnssWeek{2'345, 0, 1'000'000'000}, 9));
+
+  const std::vector<CivilTime> column{CivilTime(2026, 1, 1), CivilTime(2026, 13, 1)};
+  std::vector<char> out(64);
+  EXPECT_EQ(to_chars_column(out.data(), out.data() + out.size(), span<const CivilTime>(column))
+                .ec,
+            std::errc::invalid_argument);
+}
+
+TEST(ToChars, ColumnsWriteDelimitedRecords) {
+  const std::vector<CivilTime> civil{CivilTime(2026, 1, 1), CivilTime(2026, 1, 1, 0, 0, 1)};
+  std::vector<char> text(2 * 21);
+  auto r = to_chars_column(text.data(), text.data() + text.size(), span<const CivilTime>(civil), 0);
+  ASSERT_EQ(r.ec, std::errc{});
+  EXPECT_EQ(std::string(text.data(), r.ptr), "2026-01-01T00:00:00Z\n2026-01-01T00:00:01Z\n");
+  r = to_chars_column(text.data(), text.data() + text.size() - 1, span<const CivilTime>(civil), 0);
+  EXPECT_EQ(r.ec, std::errc::value_too_large);
+
+  std::vector<Time<scale::UTC>> utc;
+  for (int s = 0; s < 3; ++s)
+    utc.push_back(Time<scale::UTC>::from_civil(CivilTime(2026, 7, 15, 23, 59, 58 + s)));
+  char buf[128];
+  r = to_chars_column(buf, buf + sizeof buf, span<const Time<scale::UTC>>(utc), 0, ',');
+  ASSERT_EQ(r.ec, std::errc{});
+  EXPECT_EQ(std::string(buf, r.ptr),
+            "2026-07-15T23:59:58Z,2026-07-15T23:59:59Z,2026-07-16T00:00:00Z,");
+
+  const std::vector<ModifiedJulianDate<scale::TT>> mjd{ModifiedJulianDate<scale::TT>(1.5),
+                                                       ModifiedJulianDate<scale::TT>(2.25)};
+  r = to_chars_column(buf, buf + sizeof buf, span<const ModifiedJulianDate<scale::TT>>(mjd), 2);
+  EXPECT_EQ(std::string(buf, r.ptr), "1.50\n2.25\n");
+}